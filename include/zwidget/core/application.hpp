@@ -1,5 +1,12 @@
 #pragma once
 
+#include "zwidget/detail/platform.hpp"
+#include "window_state.hpp"
+
+#if ZWIDGET_PLATFORM_HEADLESS
+    #include "zwidget/platform/headless/application.hpp"
+#else
+
 #include <Windows.h>
 #include <unordered_map>
 #include <vector>
@@ -17,49 +24,6 @@ namespace zuu::widget {
     class Window;
 	class EventDispatcher;
     
-    enum class WindowState : uint32_t {
-        None            = 0,
-        Active          = 1 << 0,
-        Visible         = 1 << 1,
-        Minimized       = 1 << 2,
-        Maximized       = 1 << 3,
-        Focused         = 1 << 4,
-        Registered      = 1 << 5,
-        Unregistered    = 1 << 6,
-        Destroyed       = 1 << 7,
-        CloseRequested  = 1 << 8,
-    };
-
-    constexpr WindowState operator|(WindowState lhs, WindowState rhs) noexcept {
-        return static_cast<WindowState>(
-            static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)
-        );
-    }
-
-    constexpr WindowState operator&(WindowState lhs, WindowState rhs) noexcept {
-        return static_cast<WindowState>(
-            static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)
-        );
-    }
-
-    constexpr WindowState operator~(WindowState state) noexcept {
-        return static_cast<WindowState>(~static_cast<uint32_t>(state));
-    }
-
-    constexpr WindowState& operator|=(WindowState& lhs, WindowState rhs) noexcept {
-        lhs = lhs | rhs;
-        return lhs;
-    }
-
-    constexpr WindowState& operator&=(WindowState& lhs, WindowState rhs) noexcept {
-        lhs = lhs & rhs;
-        return lhs;
-    }
-
-    constexpr bool has_state(WindowState state, WindowState check) noexcept {
-        return (state & check) == check;
-    }
-
     LRESULT CALLBACK GlobalWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
     class Application {
@@ -187,4 +151,6 @@ namespace zuu::widget {
         }
     };
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
+
+#endif // ZWIDGET_PLATFORM_HEADLESS
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "zwidget/detail/platform.hpp"
+
+#if ZWIDGET_PLATFORM_HEADLESS
+    #include "zwidget/platform/headless/event_dispatcher.hpp"
+#else
+
 #include "zwidget/unit/event.hpp"
 #include "event_translator.hpp"
 #include "application.hpp"
@@ -135,4 +141,6 @@ namespace zuu::widget {
 		}
     };
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
+
+#endif // ZWIDGET_PLATFORM_HEADLESS
@@ -3,6 +3,10 @@
 
 #include "zwidget/unit/event.hpp"
 
+// Translasi MSG -> Event hanya ada di backend Win32. Backend headless membuat
+// Event langsung lewat HeadlessEventSource.
+#if ZWIDGET_PLATFORM_WIN32
+
 namespace zuu::widget {
 	class Window; // Forward declaration
 }
@@ -141,4 +145,6 @@ namespace zuu::detail {
 			default : return widget::Event{} ;
 		}
 	}
-}
\ No newline at end of file
+}
+
+#endif // ZWIDGET_PLATFORM_WIN32
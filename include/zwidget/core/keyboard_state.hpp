@@ -0,0 +1,89 @@
+#pragma once
+
+#include "zwidget/detail/platform.hpp"
+#include "zwidget/unit/events/keyboard.hpp"
+
+#if ZWIDGET_PLATFORM_WIN32
+    #include <Windows.h>
+#else
+    #include <array>
+    #include <unordered_map>
+#endif
+
+namespace zuu::widget {
+
+    // Query status tombol saat ini (pengganti GetKeyState yang portable).
+    // Di backend headless status per window diubah saat EventDispatcher
+    // mengambil event keyboard dari queue (bukan saat di-inject), jadi
+    // seperti GetKeyState status tersinkron dengan event yang sedang
+    // diproses. Query membaca status window dari event terakhir yang
+    // diambil; diubah dan dibaca di thread yang memproses event.
+    class KeyboardState {
+#if ZWIDGET_PLATFORM_HEADLESS
+        friend class EventDispatcher;
+        friend class Window;
+
+        using Keys = std::array<bool, 256>;
+
+        // Key = alamat Window (tidak pernah di-dereference)
+        static inline std::unordered_map<const void*, Keys> windows_{};
+        static inline const Keys* current_{nullptr};
+
+        static void set(Keys& keys, KeyboardEvent::KeyCode key, bool down) noexcept {
+            auto index = static_cast<uint16_t>(key);
+            if (index < keys.size()) keys[index] = down;
+        }
+
+        static bool get(const Keys& keys, KeyboardEvent::KeyCode key) noexcept {
+            auto index = static_cast<uint16_t>(key);
+            return index < keys.size() && keys[index];
+        }
+
+        static void apply(const void* window, KeyboardEvent::KeyCode key, bool down) {
+            using K = KeyboardEvent::KeyCode;
+            Keys& keys = windows_[window];
+            set(keys, key, down);
+
+            // GetKeyState(VK_SHIFT) true selama LShift atau RShift masih ditekan
+            auto derive = [&](K generic, K left, K right) {
+                if (key == left || key == right) set(keys, generic, get(keys, left) || get(keys, right));
+            };
+            derive(K::Shift, K::LeftShift, K::RightShift);
+            derive(K::Control, K::LeftControl, K::RightControl);
+            derive(K::Alt, K::LeftAlt, K::RightAlt);
+        }
+
+        static void activate(const void* window) {
+            auto it = windows_.find(window);
+            current_ = it != windows_.end() ? &it->second : nullptr;
+        }
+
+        static void forget(const void* window) {
+            auto it = windows_.find(window);
+            if (it == windows_.end()) return;
+            if (current_ == &it->second) current_ = nullptr;
+            windows_.erase(it);
+        }
+#endif
+
+    public:
+        KeyboardState() = delete;
+
+        static bool is_down(KeyboardEvent::KeyCode key) noexcept {
+#if ZWIDGET_PLATFORM_WIN32
+            return (GetKeyState(static_cast<int>(key)) & 0x8000) != 0;
+#else
+            return current_ && get(*current_, key);
+#endif
+        }
+
+        static bool is_shift_down() noexcept {
+            return is_down(KeyboardEvent::KeyCode::Shift);
+        }
+
+        static bool is_control_down() noexcept {
+            return is_down(KeyboardEvent::KeyCode::Control);
+        }
+    };
+
+} // namespace zuu::widget
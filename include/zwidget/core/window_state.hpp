@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+namespace zuu::widget {
+
+    enum class WindowState : uint32_t {
+        None            = 0,
+        Active          = 1 << 0,
+        Visible         = 1 << 1,
+        Minimized       = 1 << 2,
+        Maximized       = 1 << 3,
+        Focused         = 1 << 4,
+        Registered      = 1 << 5,
+        Unregistered    = 1 << 6,
+        Destroyed       = 1 << 7,
+        CloseRequested  = 1 << 8,
+    };
+
+    constexpr WindowState operator|(WindowState lhs, WindowState rhs) noexcept {
+        return static_cast<WindowState>(
+            static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)
+        );
+    }
+
+    constexpr WindowState operator&(WindowState lhs, WindowState rhs) noexcept {
+        return static_cast<WindowState>(
+            static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)
+        );
+    }
+
+    constexpr WindowState operator~(WindowState state) noexcept {
+        return static_cast<WindowState>(~static_cast<uint32_t>(state));
+    }
+
+    constexpr WindowState& operator|=(WindowState& lhs, WindowState rhs) noexcept {
+        lhs = lhs | rhs;
+        return lhs;
+    }
+
+    constexpr WindowState& operator&=(WindowState& lhs, WindowState rhs) noexcept {
+        lhs = lhs & rhs;
+        return lhs;
+    }
+
+    constexpr bool has_state(WindowState state, WindowState check) noexcept {
+        return (state & check) == check;
+    }
+
+} // namespace zuu::widget
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace zuu::widget::detail {
+
+	// Hash 64-bit cepat untuk state render widget. Diproses per word 8 byte
+	// (round ala xxHash64), karena dihitung ulang setiap frame untuk setiap
+	// widget yang di-cache. Bukan hash kriptografis.
+	class StateHasher {
+	private :
+		static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull ;
+		static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full ;
+
+		uint64_t state_ {0x27D4EB2F165667C5ull} ;
+
+		static constexpr uint64_t rotl(uint64_t v, int r) noexcept {
+			return (v << r) | (v >> (64 - r)) ;
+		}
+
+		void mix(uint64_t word) noexcept {
+			state_ ^= rotl(word * prime2, 31) * prime1 ;
+			state_ = rotl(state_, 27) * prime1 + 0x85EBCA77C2B2AE63ull ;
+		}
+
+	public :
+		void add_bytes(const void* data, size_t size) noexcept {
+			auto* bytes = static_cast<const unsigned char*>(data) ;
+			while (size >= 8) {
+				uint64_t word ;
+				std::memcpy(&word, bytes, 8) ;
+				mix(word) ;
+				bytes += 8 ;
+				size -= 8 ;
+			}
+			if (size) {
+				uint64_t word = 0 ;
+				std::memcpy(&word, bytes, size) ;
+				mix(word ^ (static_cast<uint64_t>(size) << 56)) ;
+			}
+		}
+
+		template <typename T>
+			requires std::is_trivially_copyable_v<T>
+		StateHasher& add(const T& value) noexcept {
+			add_bytes(&value, sizeof(T)) ;
+			return *this ;
+		}
+
+		StateHasher& add(const std::wstring& text) noexcept {
+			mix(text.size()) ;
+			add_bytes(text.data(), text.size() * sizeof(wchar_t)) ;
+			return *this ;
+		}
+
+		uint64_t value() const noexcept {
+			uint64_t h = state_ ;
+			h ^= h >> 33 ;
+			h *= prime2 ;
+			h ^= h >> 29 ;
+			return h ;
+		}
+	} ;
+
+} // namespace zuu::widget::detail
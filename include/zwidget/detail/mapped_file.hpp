@@ -0,0 +1,112 @@
+#pragma once
+
+#include "platform.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if ZWIDGET_PLATFORM_WIN32
+	#include <Windows.h>
+
+	#ifdef min
+		#undef min
+	#endif
+	#ifdef max
+		#undef max
+	#endif
+#elif defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define ZWIDGET_HAS_MMAP 1
+#endif
+
+namespace zuu::widget::detail {
+
+	// File read-only yang di-map ke memori (MapViewOfFile / mmap), jadi isi
+	// file tidak disalin saat dibuka; halaman baru dibaca OS saat disentuh.
+	// Platform tanpa keduanya (headless di Windows) membaca file ke buffer.
+	class MappedFile {
+	private :
+		const uint8_t* data_ {nullptr} ;
+		size_t size_ {0} ;
+		std::vector<uint8_t> buffer_ ;
+#if ZWIDGET_PLATFORM_WIN32
+		HANDLE mapping_ {nullptr} ;
+#endif
+
+		MappedFile() = default ;
+
+		bool read_all(const std::string& path) {
+			std::ifstream file(path, std::ios::binary | std::ios::ate) ;
+			if (!file) return false ;
+			buffer_.resize(static_cast<size_t>(file.tellg())) ;
+			file.seekg(0) ;
+			if (!file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()))) return false ;
+			data_ = buffer_.data() ;
+			size_ = buffer_.size() ;
+			return true ;
+		}
+
+		bool map(const std::string& path) {
+#if ZWIDGET_PLATFORM_WIN32
+			HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) ;
+			if (file == INVALID_HANDLE_VALUE) return false ;
+			LARGE_INTEGER size {} ;
+			if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+				mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) ;
+			}
+			CloseHandle(file) ;
+			if (!mapping_) return false ;
+			data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)) ;
+			size_ = static_cast<size_t>(size.QuadPart) ;
+			return data_ != nullptr ;
+#elif defined(ZWIDGET_HAS_MMAP)
+			int fd = ::open(path.c_str(), O_RDONLY) ;
+			if (fd < 0) return false ;
+			struct stat info {} ;
+			void* view = MAP_FAILED ;
+			if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+				view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0) ;
+			}
+			::close(fd) ;
+			if (view == MAP_FAILED) return false ;
+			data_ = static_cast<const uint8_t*>(view) ;
+			size_ = static_cast<size_t>(info.st_size) ;
+			return true ;
+#else
+			return read_all(path) ;
+#endif
+		}
+
+	public :
+		MappedFile(const MappedFile&) = delete ;
+		MappedFile& operator=(const MappedFile&) = delete ;
+
+		~MappedFile() {
+			if (!buffer_.empty()) return ;
+#if ZWIDGET_PLATFORM_WIN32
+			if (data_) UnmapViewOfFile(data_) ;
+			if (mapping_) CloseHandle(mapping_) ;
+#elif defined(ZWIDGET_HAS_MMAP)
+			if (data_) ::munmap(const_cast<uint8_t*>(data_), size_) ;
+#endif
+		}
+
+		// nullptr kalau file tidak ada / kosong / gagal di-map
+		static std::shared_ptr<MappedFile> open(const std::string& path) {
+			std::shared_ptr<MappedFile> file(new MappedFile()) ;
+			if (!file->map(path)) return nullptr ;
+			return file ;
+		}
+
+		const uint8_t* data() const noexcept { return data_ ; }
+		size_t size() const noexcept { return size_ ; }
+	} ;
+
+} // namespace zuu::widget::detail
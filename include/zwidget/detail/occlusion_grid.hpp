@@ -0,0 +1,103 @@
+#pragma once
+
+#include "zwidget/unit/rect.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace zuu::widget::detail {
+
+	// Grid seragam berisi rect occluder (piksel opaque), supaya query "rect
+	// mana yang menimpa area ini" tidak O(n) per widget. Dipakai Container
+	// dengan sweep dari child terakhir ke pertama: saat child i di-query,
+	// grid hanya berisi occluder dari sibling di atasnya.
+	class OcclusionGrid {
+	private :
+		static constexpr int max_cells = 64 ;	// Per sumbu
+
+		basic_rect<int> extents_ ;
+		int cell_w_ {1} ;
+		int cell_h_ {1} ;
+		int cols_ {0} ;
+		int rows_ {0} ;
+		std::vector<std::vector<uint32_t>> cells_ ;
+		std::vector<basic_rect<int>> rects_ ;
+		std::vector<uint32_t> stamps_ ;		// Dedupe rect yang ada di beberapa cell
+		uint32_t query_ {0} ;
+
+		bool cell_range(const basic_rect<int>& r, int& c0, int& r0, int& c1, int& r1) const noexcept {
+			int x0 = std::max(r.x, extents_.x), y0 = std::max(r.y, extents_.y) ;
+			int x1 = std::min(r.x + r.w, extents_.x + extents_.w) ;
+			int y1 = std::min(r.y + r.h, extents_.y + extents_.h) ;
+			if (x1 <= x0 || y1 <= y0) return false ;
+
+			c0 = (x0 - extents_.x) / cell_w_ ;
+			r0 = (y0 - extents_.y) / cell_h_ ;
+			c1 = (x1 - 1 - extents_.x) / cell_w_ ;
+			r1 = (y1 - 1 - extents_.y) / cell_h_ ;
+			return true ;
+		}
+
+	public :
+		// Kosongkan grid dan set area yang dicakup; cell minimal cell_size
+		void reset(const basic_rect<int>& extents, int cell_size = 64) {
+			for (auto& cell : cells_) cell.clear() ;
+			rects_.clear() ;
+			stamps_.clear() ;
+
+			extents_ = extents ;
+			if (extents.w <= 0 || extents.h <= 0) {
+				cols_ = rows_ = 0 ;
+				return ;
+			}
+			cell_w_ = std::max(cell_size, (extents.w + max_cells - 1) / max_cells) ;
+			cell_h_ = std::max(cell_size, (extents.h + max_cells - 1) / max_cells) ;
+			cols_ = (extents.w + cell_w_ - 1) / cell_w_ ;
+			rows_ = (extents.h + cell_h_ - 1) / cell_h_ ;
+			if (cells_.size() < static_cast<size_t>(cols_ * rows_)) {
+				cells_.resize(static_cast<size_t>(cols_ * rows_)) ;
+			}
+		}
+
+		bool empty() const noexcept { return rects_.empty() ; }
+
+		void add(const basic_rect<int>& rect) {
+			int c0, r0, c1, r1 ;
+			if (rect.w <= 0 || rect.h <= 0 || !cell_range(rect, c0, r0, c1, r1)) return ;
+
+			auto index = static_cast<uint32_t>(rects_.size()) ;
+			rects_.push_back(rect) ;
+			stamps_.push_back(0) ;
+			for (int r = r0 ; r <= r1 ; ++r) {
+				for (int c = c0 ; c <= c1 ; ++c) {
+					cells_[static_cast<size_t>(r * cols_ + c)].push_back(index) ;
+				}
+			}
+		}
+
+		// Panggil fn(rect) sekali untuk setiap occluder yang overlap area
+		template <typename Fn>
+		void query(const basic_rect<int>& area, Fn&& fn) {
+			int c0, r0, c1, r1 ;
+			if (rects_.empty() || !cell_range(area, c0, r0, c1, r1)) return ;
+
+			++query_ ;
+			for (int r = r0 ; r <= r1 ; ++r) {
+				for (int c = c0 ; c <= c1 ; ++c) {
+					for (uint32_t index : cells_[static_cast<size_t>(r * cols_ + c)]) {
+						if (stamps_[index] == query_) continue ;
+						stamps_[index] = query_ ;
+
+						const auto& rect = rects_[index] ;
+						if (rect.x < area.x + area.w && area.x < rect.x + rect.w &&
+							rect.y < area.y + area.h && area.y < rect.y + rect.h) {
+							fn(rect) ;
+						}
+					}
+				}
+			}
+		}
+	} ;
+
+} // namespace zuu::widget::detail
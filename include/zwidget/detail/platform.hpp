@@ -0,0 +1,13 @@
+#pragma once
+
+// Backend selection.
+// Win32 + Direct2D dipakai default di Windows; semua platform lain (atau
+// build yang mendefinisikan ZWIDGET_HEADLESS) memakai backend portable
+// tanpa header Windows sama sekali.
+#if defined(_WIN32) && !defined(ZWIDGET_HEADLESS)
+	#define ZWIDGET_PLATFORM_WIN32 1
+	#define ZWIDGET_PLATFORM_HEADLESS 0
+#else
+	#define ZWIDGET_PLATFORM_WIN32 0
+	#define ZWIDGET_PLATFORM_HEADLESS 1
+#endif
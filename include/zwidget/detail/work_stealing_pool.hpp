@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace zuu::widget::detail {
+
+	// Pool thread persisten untuk parallel-for berbasis index task. Task dibagi
+	// rata (blok kontigu, jaga lokalitas tile) ke deque per worker; worker
+	// mengambil dari depan deque sendiri dan, saat kosong, mencuri dari
+	// belakang deque worker lain. Thread pemanggil run() ikut jadi worker 0.
+	class WorkStealingPool {
+	private :
+		struct alignas(64) Queue {
+			std::mutex mutex ;
+			std::deque<uint32_t> tasks ;
+		} ;
+
+		unsigned size_ {1} ;
+		std::unique_ptr<Queue[]> queues_ ;
+		std::vector<std::thread> threads_ ;
+
+		std::mutex mutex_ ;
+		std::condition_variable wake_ ;
+		std::condition_variable done_ ;
+		uint64_t generation_ {0} ;
+		bool stop_ {false} ;
+
+		// Job aktif (type-erased); valid selama run() belum kembali
+		void (*invoke_)(void*, size_t, unsigned) {nullptr} ;
+		void* context_ {nullptr} ;
+		std::atomic<size_t> remaining_ {0} ;
+		std::atomic<uint64_t> steals_ {0} ;
+
+		bool pop(unsigned worker, uint32_t& task) {
+			Queue& own = queues_[worker] ;
+			{
+				std::lock_guard lock(own.mutex) ;
+				if (!own.tasks.empty()) {
+					task = own.tasks.front() ;
+					own.tasks.pop_front() ;
+					return true ;
+				}
+			}
+
+			for (unsigned i = 1 ; i < size_ ; ++i) {
+				Queue& victim = queues_[(worker + i) % size_] ;
+				std::lock_guard lock(victim.mutex) ;
+				if (!victim.tasks.empty()) {
+					task = victim.tasks.back() ;
+					victim.tasks.pop_back() ;
+					steals_.fetch_add(1, std::memory_order_relaxed) ;
+					return true ;
+				}
+			}
+			return false ;
+		}
+
+		void work(unsigned worker) {
+			uint32_t task ;
+			while (pop(worker, task)) {
+				invoke_(context_, task, worker) ;
+				if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					std::lock_guard lock(mutex_) ;
+					done_.notify_all() ;
+				}
+			}
+		}
+
+		void worker_loop(unsigned worker) {
+			uint64_t seen = 0 ;
+			for (;;) {
+				{
+					std::unique_lock lock(mutex_) ;
+					wake_.wait(lock, [&] { return stop_ || generation_ != seen ; }) ;
+					if (stop_) return ;
+					seen = generation_ ;
+				}
+				work(worker) ;
+			}
+		}
+
+	public :
+		// threads = jumlah worker termasuk pemanggil; 0 = hardware_concurrency
+		explicit WorkStealingPool(unsigned threads = 0) {
+			if (threads == 0) {
+				threads = std::max(1u, std::thread::hardware_concurrency()) ;
+			}
+			size_ = threads ;
+			queues_ = std::make_unique<Queue[]>(size_) ;
+
+			threads_.reserve(size_ - 1) ;
+			for (unsigned i = 1 ; i < size_ ; ++i) {
+				threads_.emplace_back([this, i] { worker_loop(i) ; }) ;
+			}
+		}
+
+		~WorkStealingPool() {
+			{
+				std::lock_guard lock(mutex_) ;
+				stop_ = true ;
+			}
+			wake_.notify_all() ;
+			for (auto& thread : threads_) {
+				thread.join() ;
+			}
+		}
+
+		WorkStealingPool(const WorkStealingPool&) = delete ;
+		WorkStealingPool& operator=(const WorkStealingPool&) = delete ;
+
+		unsigned size() const noexcept { return size_ ; }
+
+		// Task yang diambil dari deque worker lain sejak pool dibuat
+		uint64_t steals() const noexcept { return steals_.load(std::memory_order_relaxed) ; }
+
+		// Jalankan fn(task, worker) untuk task 0..count-1, blocking sampai
+		// semua selesai. worker < size(), unik per thread selama satu run.
+		template <typename Fn>
+		void run(size_t count, Fn&& fn) {
+			if (count == 0) return ;
+			if (size_ == 1 || count == 1) {
+				for (size_t i = 0 ; i < count ; ++i) fn(i, 0u) ;
+				return ;
+			}
+
+			using F = std::remove_reference_t<Fn> ;
+			invoke_ = [](void* context, size_t task, unsigned worker) {
+				(*static_cast<F*>(context))(task, worker) ;
+			} ;
+			context_ = const_cast<void*>(static_cast<const void*>(std::addressof(fn))) ;
+			remaining_.store(count, std::memory_order_relaxed) ;
+
+			for (unsigned w = 0 ; w < size_ ; ++w) {
+				size_t begin = count * w / size_ ;
+				size_t end = count * (w + 1) / size_ ;
+				std::lock_guard lock(queues_[w].mutex) ;
+				for (size_t i = begin ; i < end ; ++i) {
+					queues_[w].tasks.push_back(static_cast<uint32_t>(i)) ;
+				}
+			}
+
+			{
+				std::lock_guard lock(mutex_) ;
+				++generation_ ;
+			}
+			wake_.notify_all() ;
+
+			work(0) ;
+
+			std::unique_lock lock(mutex_) ;
+			done_.wait(lock, [&] { return remaining_.load(std::memory_order_acquire) == 0 ; }) ;
+		}
+	} ;
+
+} // namespace zuu::widget::detail
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace zuu::widget::detail {
+
+    // Rounded box [x0,x1) x [y0,y1) dengan sudut elips (rx, ry). Ellipse adalah
+    // kasus khusus rx = w/2, ry = h/2; rect biasa rx = ry = 0.
+    //
+    // Tepi kanan sebagai fungsi y:  R(y) = (x1 - rx) + rx * sqrt(1 - u^2),
+    // u = jarak vertikal ke pita lurus / ry. Tepi kiri simetris. Luas di
+    // bawah busur punya bentuk tertutup, jadi coverage tiap pixel dihitung
+    // eksak (integral luas), bukan dengan supersampling.
+    struct RoundedBox {
+        double x0{0}, y0{0}, x1{0}, y1{0};
+        double rx{0}, ry{0};
+
+        static RoundedBox make(double x0, double y0, double x1, double y1, double rx, double ry) noexcept {
+            RoundedBox box{x0, y0, x1, y1, 0, 0};
+            if (x1 <= x0 || y1 <= y0) return box;
+
+            rx = std::clamp(rx, 0.0, (x1 - x0) * 0.5);
+            ry = std::clamp(ry, 0.0, (y1 - y0) * 0.5);
+            if (rx > 0 && ry > 0) {
+                box.rx = rx;
+                box.ry = ry;
+            }
+            return box;
+        }
+
+        bool empty() const noexcept {
+            return x1 <= x0 || y1 <= y0;
+        }
+
+        // Cermin terhadap x = 0: tepi kiri jadi tepi kanan
+        RoundedBox mirrored() const noexcept {
+            return RoundedBox{-x1, y0, -x0, y1, rx, ry};
+        }
+
+        // Lebar setengah busur (0..rx) pada y, di luar pita lurus
+        double arc(double y) const noexcept {
+            if (rx <= 0) return 0;
+            double d = std::max({0.0, (y0 + ry) - y, y - (y1 - ry)}) / ry;
+            return d >= 1.0 ? 0.0 : rx * std::sqrt(1.0 - d * d);
+        }
+
+        double right_at(double y) const noexcept { return x1 - rx + arc(y); }
+        double left_at(double y) const noexcept { return x0 + rx - arc(y); }
+
+        // Rentang x tepi kanan / kiri sepanjang [ya, yb]
+        void right_extent(double ya, double yb, double& lo, double& hi) const noexcept {
+            double a = right_at(ya), b = right_at(yb);
+            lo = std::min(a, b);
+            hi = (ya < y1 - ry && yb > y0 + ry) ? x1 : std::max(a, b);
+        }
+
+        void left_extent(double ya, double yb, double& lo, double& hi) const noexcept {
+            double a = left_at(ya), b = left_at(yb);
+            hi = std::max(a, b);
+            lo = (ya < y1 - ry && yb > y0 + ry) ? x0 : std::min(a, b);
+        }
+    };
+
+    // Integral seperempat lingkaran satuan: d/du = sqrt(1 - u^2)
+    inline double quarter_circle_area(double u) noexcept {
+        u = std::clamp(u, 0.0, 1.0);
+        return 0.5 * (u * std::sqrt(1.0 - u * u) + std::asin(u));
+    }
+
+    // Integral max(0, sqrt(1 - u^2) - k) du pada [u0, u1], 0 <= u0 <= u1 <= 1
+    inline double arc_area_above(double u0, double u1, double k) noexcept {
+        if (k >= 1.0 || u1 <= u0) return 0;
+        if (k > 0) {
+            u1 = std::min(u1, std::sqrt(1.0 - k * k));
+            if (u1 <= u0) return 0;
+        }
+        return quarter_circle_area(u1) - quarter_circle_area(u0) - k * (u1 - u0);
+    }
+
+    // Integral max(0, R(y) - t) dy pada [ya, yb]: luas bentuk di kanan x = t
+    inline double area_right_of(const RoundedBox& box, double ya, double yb, double t) noexcept {
+        double top = box.y0 + box.ry;
+        double bottom = box.y1 - box.ry;
+        double area = 0;
+
+        // Pita lurus
+        double ma = std::max(ya, top), mb = std::min(yb, bottom);
+        if (mb > ma) area += (mb - ma) * std::max(0.0, box.x1 - t);
+        if (box.rx <= 0) return area;
+
+        double k = (t - (box.x1 - box.rx)) / box.rx;
+        double scale = box.rx * box.ry;
+
+        // Busur atas: u = (top - y) / ry
+        if (ya < top) {
+            double b = std::min(yb, top);
+            area += scale * arc_area_above((top - b) / box.ry, (top - ya) / box.ry, k);
+        }
+        // Busur bawah: u = (y - bottom) / ry
+        if (yb > bottom) {
+            double a = std::max(ya, bottom);
+            area += scale * arc_area_above((a - bottom) / box.ry, (yb - bottom) / box.ry, k);
+        }
+        return area;
+    }
+
+    // Integral clamp(R(y) - px, 0, 1) dy: bagian kolom [px, px+1) di kiri tepi kanan
+    inline double right_edge_coverage(const RoundedBox& box, double ya, double yb, double px) noexcept {
+        return area_right_of(box, ya, yb, px) - area_right_of(box, ya, yb, px + 1.0);
+    }
+
+    // Luas eksak box di dalam pixel kolom px, baris [ya, yb] (sudah di-clip
+    // ke [y0, y1]). Overlap [L, R] dengan [px, px+1) = clamp(R - px) - clamp(L - px).
+    inline double box_coverage(const RoundedBox& box, const RoundedBox& mirror, double ya, double yb, double px) noexcept {
+        double right = right_edge_coverage(box, ya, yb, px);
+        double left = (yb - ya) - right_edge_coverage(mirror, ya, yb, -px - 1.0);
+        return std::max(0.0, right - left);
+    }
+
+} // namespace zuu::widget::detail
@@ -0,0 +1,782 @@
+#pragma once
+
+#include "canvas.hpp"
+#include "zwidget/detail/work_stealing_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Backend CPU yang bisa membuat view per tile ke framebuffer-nya
+    template <typename B>
+    concept TileBackend = std::default_initializable<B>
+        && requires(B& view, const B& parent, const basic_rect<int>& tile) {
+            view.attach_tile(parent, tile);
+            { parent.get_clip() } -> std::convertible_to<basic_rect<int>>;
+        };
+
+    // BatchingCanvas<Backend> - lapisan batching di atas backend Canvas.
+    //
+    // Selama batching aktif, primitive tidak langsung dikirim ke backend tapi
+    // ditampung. Saat flush (perubahan clip/state, clear, atau akhir frame)
+    // primitive dikelompokkan per state (jenis + warna + lebar stroke): tiap
+    // primitive boleh "naik" bergabung ke batch sebelumnya dengan state sama
+    // asalkan tidak overlap dengan batch mana pun di antaranya, jadi urutan
+    // painter tetap benar di setiap piksel. Batch fill_rect / draw_rect
+    // dikirim sebagai satu fill_rects / draw_rects ke backend.
+    //
+    // Untuk TileBackend ada mode tiled: saat flush, item di-bin ke tile layar
+    // (default 64x64) berdasarkan bounds-nya, lalu tile di-raster paralel di
+    // WorkStealingPool. Tiap worker memakai view backend yang di-clip ke
+    // tile-nya, jadi tidak ada dua thread yang menulis pixel yang sama.
+    //
+    // Transform translasi (kasus umum: widget menggambar di koordinat lokal)
+    // langsung dijumlahkan ke koordinat item saat direkam, jadi tidak
+    // memotong batch; item disimpan di koordinat device dan backend di-flush
+    // dengan transform identity. Transform lain (skala, rotasi) flush lalu
+    // diteruskan ke backend per primitive.
+    template <typename Backend>
+    class BatchingCanvas : public Backend {
+        static_assert(std::is_base_of_v<Canvas, Backend>, "Backend must derive from Canvas");
+
+    private:
+        enum class Kind : uint8_t {
+            FillRect,
+            DrawRect,
+            FillRoundedRect,
+            DrawRoundedRect,
+            FillEllipse,
+            DrawEllipse,
+            Line,
+            Text,
+            CachedText,
+            FillPath,
+            StrokePath
+        };
+
+        struct Bounds {
+            float x0, y0, x1, y1;
+
+            bool overlaps(const Bounds& o) const noexcept {
+                return x0 < o.x1 && o.x0 < x1 && y0 < o.y1 && o.y0 < y1;
+            }
+
+            void unite(const Bounds& o) noexcept {
+                x0 = std::min(x0, o.x0);
+                y0 = std::min(y0, o.y0);
+                x1 = std::max(x1, o.x1);
+                y1 = std::max(y1, o.y1);
+            }
+        };
+
+        struct Item {
+            Kind kind;
+            ColorU8 color;
+            float width;                // Lebar stroke (0 untuk fill)
+            basic_rect<float> rect;     // Rect, atau center (x, y) + radius (w, h) untuk ellipse
+            float radius_x, radius_y;
+            basic_point<float> start, end;
+            TextFormat* format;
+            uint32_t text_index;        // Index strings_ (Text) atau paths_ (path)
+            Transform transform;
+            FillRule rule;
+            StrokeStyle stroke;
+            Bounds bounds;
+            uint32_t batch;
+        };
+
+        struct Batch {
+            Kind kind;
+            ColorU8 color;
+            float width;
+            TextFormat* format;
+            Bounds bounds;
+        };
+
+        // Batas mundur pencarian batch, menjaga flush tetap O(n)
+        static constexpr size_t max_lookback = 32;
+
+        std::vector<Item> items_;
+        std::vector<Batch> batches_;
+        std::vector<Item> sorted_;
+        std::vector<uint32_t> batch_offsets_;
+        std::vector<basic_rect<float>> rect_scratch_;
+        std::vector<std::wstring> strings_;
+        size_t string_count_{0};
+
+        // Mode tiled: pool, satu view backend per worker, item per tile
+        struct TileState {
+            detail::WorkStealingPool pool;
+            std::vector<Backend> views;
+            std::vector<std::vector<uint32_t>> bins;
+            std::vector<uint32_t> active;
+            int tile_size;
+
+            TileState(unsigned threads, int size) : pool(threads), views(pool.size()), tile_size(size) {}
+        };
+
+        // Di bawah ini overhead bangunin worker lebih mahal dari rasterisasi
+        static constexpr size_t min_tiled_items = 64;
+
+        std::unique_ptr<TileState> tiles_;
+        std::vector<Path> paths_;
+        size_t path_count_{0};
+        bool batching_{false};
+
+        // Transform yang sedang diterapkan state backend; transform_ (logis,
+        // milik Canvas) bisa berbeda selama item di-bake ke device space
+        Transform backend_transform_;
+
+        // Item boleh direkam: batching aktif dan transform cuma translasi
+        bool recording() const noexcept {
+            return batching_ && this->transform_.is_translation();
+        }
+
+        float offset_x() const noexcept { return this->transform_.dx; }
+        float offset_y() const noexcept { return this->transform_.dy; }
+
+        basic_rect<float> bake(const basic_rect<float>& r) const noexcept {
+            return basic_rect<float>(r.x + offset_x(), r.y + offset_y(), r.w, r.h);
+        }
+
+        basic_point<float> bake(const basic_point<float>& p) const noexcept {
+            return basic_point<float>(p.x + offset_x(), p.y + offset_y());
+        }
+
+        // Set state transform backend tanpa mengubah transform logis
+        void use_backend_transform(const Transform& transform) {
+            if (backend_transform_ == transform) return;
+            Transform logical = this->transform_;
+            Backend::set_transform(transform);
+            this->transform_ = logical;
+            backend_transform_ = transform;
+        }
+
+        static bool same_state(const Batch& batch, const Item& item) noexcept {
+            return batch.kind == item.kind
+                && batch.width == item.width
+                && batch.format == item.format
+                && batch.color == item.color;
+        }
+
+        // Bounds di-snap keluar ke piksel: dua primitive yang berbagi satu
+        // piksel tepi (coverage AA) dianggap overlap
+        static Bounds bounds_of(float x0, float y0, float x1, float y1, float stroke) noexcept {
+            float pad = stroke * 0.5f;
+            return Bounds{
+                std::floor(std::min(x0, x1) - pad), std::floor(std::min(y0, y1) - pad),
+                std::ceil(std::max(x0, x1) + pad), std::ceil(std::max(y0, y1) + pad)
+            };
+        }
+
+        static Bounds text_bounds_of(const std::wstring& text, const basic_rect<float>& rect, float size) noexcept {
+            basic_rect<float> r = Canvas::text_bounds(text, rect, size);
+            return bounds_of(r.x, r.y, r.x + r.w, r.y + r.h, 0.0f);
+        }
+
+        static Bounds bounds_of(const basic_rect<float>& r, float stroke) noexcept {
+            return bounds_of(r.x, r.y, r.x + r.w, r.y + r.h, stroke);
+        }
+
+        // Bounds titik kontrol setelah transform; stroke diperlebar sampai
+        // ujung miter / cap square terjauh
+        static Bounds path_bounds_of(const Path& path, const Transform& transform, const StrokeStyle* stroke) noexcept {
+            basic_rect<float> r = Canvas::map_rect(transform, path.bounds());
+            float x0 = r.x, y0 = r.y, x1 = r.x + r.w, y1 = r.y + r.h;
+
+            float width = 0.0f;
+            if (stroke) {
+                float reach = stroke->join == LineJoin::Miter ? std::max(stroke->miter_limit, 1.5f) : 1.5f;
+                width = stroke->width * transform.max_scale() * reach;
+            }
+            return bounds_of(x0, y0, x1, y1, width);
+        }
+
+        uint32_t store_path(const Path& path) {
+            if (path_count_ == paths_.size()) {
+                paths_.emplace_back();
+            }
+            paths_[path_count_] = path;
+            paths_[path_count_].hash();         // Hash di-cache sekarang, bukan dari worker tile
+            return static_cast<uint32_t>(path_count_++);
+        }
+
+        void enqueue(Item item) {
+            ++this->frame_stats_.draw_calls;
+
+            // Di luar clip efektif: tidak pernah masuk batch. Bounds sudah di
+            // device space; +1px untuk antialiasing.
+            if (this->cull(basic_rect<float>(item.bounds.x0 - 1.0f, item.bounds.y0 - 1.0f,
+                    item.bounds.x1 - item.bounds.x0 + 2.0f, item.bounds.y1 - item.bounds.y0 + 2.0f))) {
+                return;
+            }
+
+            size_t count = batches_.size();
+            size_t stop = count > max_lookback ? count - max_lookback : 0;
+            for (size_t i = count; i > stop; --i) {
+                Batch& batch = batches_[i - 1];
+                if (same_state(batch, item)) {
+                    batch.bounds.unite(item.bounds);
+                    item.batch = static_cast<uint32_t>(i - 1);
+                    items_.push_back(item);
+                    return;
+                }
+                if (batch.bounds.overlaps(item.bounds)) break;
+            }
+
+            item.batch = static_cast<uint32_t>(count);
+            batches_.push_back(Batch{item.kind, item.color, item.width, item.format, item.bounds});
+            items_.push_back(item);
+        }
+
+        void enqueue_text(Kind kind, const std::wstring& text, const basic_rect<float>& rect,
+            ColorU8 color, TextFormat* text_format) {
+            if (string_count_ == strings_.size()) {
+                strings_.emplace_back();
+            }
+            strings_[string_count_].assign(text);
+
+            Item item{};
+            item.kind = kind;
+            item.color = color;
+            item.rect = bake(rect);
+            item.format = text_format;
+            item.text_index = static_cast<uint32_t>(string_count_++);
+            if (kind == Kind::CachedText) {
+                // Bounds tinta dari layout backend: jauh lebih ketat dari
+                // perkiraan, jadi teks tidak memutus batch baris tetangga
+                item.bounds = bounds_of(Backend::cached_text_bounds(text, item.rect, text_format), 0.0f);
+            } else {
+                item.bounds = text_bounds_of(text, item.rect, text_format_size(text_format));
+            }
+            enqueue(item);
+        }
+
+        void submit_one(Backend& target, const Item& item) {
+            switch (item.kind) {
+                case Kind::FillRect:
+                    target.Backend::fill_rect(item.rect, item.color);
+                    break;
+                case Kind::DrawRect:
+                    target.Backend::draw_rect(item.rect, item.color, item.width);
+                    break;
+                case Kind::FillRoundedRect:
+                    target.Backend::fill_rounded_rect(item.rect, item.radius_x, item.radius_y, item.color);
+                    break;
+                case Kind::DrawRoundedRect:
+                    target.Backend::draw_rounded_rect(item.rect, item.radius_x, item.radius_y, item.color, item.width);
+                    break;
+                case Kind::FillEllipse:
+                    target.Backend::fill_ellipse(
+                        basic_point<float>(item.rect.x, item.rect.y), item.rect.w, item.rect.h, item.color);
+                    break;
+                case Kind::DrawEllipse:
+                    target.Backend::draw_ellipse(
+                        basic_point<float>(item.rect.x, item.rect.y), item.rect.w, item.rect.h, item.color, item.width);
+                    break;
+                case Kind::Line:
+                    target.Backend::draw_line(item.start, item.end, item.color, item.width);
+                    break;
+                case Kind::Text:
+                    target.Backend::draw_text(strings_[item.text_index], item.rect, item.color, item.format);
+                    break;
+                case Kind::CachedText:
+                    target.Backend::draw_cached_text(strings_[item.text_index], item.rect, item.color, item.format);
+                    break;
+                case Kind::FillPath:
+                    target.Backend::fill_path(paths_[item.text_index], item.color, item.rule, item.transform);
+                    break;
+                case Kind::StrokePath:
+                    target.Backend::stroke_path(paths_[item.text_index], item.color, item.stroke, item.transform);
+                    break;
+            }
+        }
+
+    public:
+        using Backend::Backend;
+
+        // Aktif/nonaktifkan batching; menonaktifkan berarti flush dulu
+        void set_batching(bool enabled) {
+            if (!enabled) flush();
+            batching_ = enabled;
+        }
+
+        bool is_batching() const noexcept {
+            return batching_;
+        }
+
+        // Kirim semua primitive yang tertampung ke backend
+        void flush() {
+            if (items_.empty()) return;
+            use_backend_transform(Transform::identity());     // Item sudah di device space
+
+            // Counting sort item per batch (stabil: urutan dalam batch tetap)
+            batch_offsets_.assign(batches_.size() + 1, 0);
+            for (const auto& item : items_) {
+                ++batch_offsets_[item.batch + 1];
+            }
+            for (size_t i = 1; i < batch_offsets_.size(); ++i) {
+                batch_offsets_[i] += batch_offsets_[i - 1];
+            }
+            sorted_.resize(items_.size());
+            for (const auto& item : items_) {
+                sorted_[batch_offsets_[item.batch]++] = item;
+            }
+
+            if constexpr (TileBackend<Backend>) {
+                if (tiles_ && sorted_.size() >= min_tiled_items) {
+                    flush_tiled();
+                    reset_items();
+                    return;
+                }
+            }
+
+            auto& stats = this->frame_stats_;
+            size_t begin = 0;
+            for (const auto& batch : batches_) {
+                size_t end = begin;
+                while (end < sorted_.size() && sorted_[end].batch == sorted_[begin].batch) ++end;
+
+                if (batch.kind == Kind::FillRect || batch.kind == Kind::DrawRect) {
+                    rect_scratch_.clear();
+                    for (size_t i = begin; i < end; ++i) {
+                        rect_scratch_.push_back(sorted_[i].rect);
+                    }
+                    if (batch.kind == Kind::FillRect) {
+                        Backend::fill_rects(rect_scratch_, batch.color);
+                    } else {
+                        Backend::draw_rects(rect_scratch_, batch.color, batch.width);
+                    }
+                    ++stats.submitted_draw_calls;
+                } else {
+                    for (size_t i = begin; i < end; ++i) {
+                        submit_one(*this, sorted_[i]);
+                    }
+                    stats.submitted_draw_calls += static_cast<uint32_t>(end - begin);
+                }
+                ++stats.batches;
+                begin = end;
+            }
+
+            reset_items();
+        }
+
+        // Mode tiled (hanya TileBackend). threads termasuk thread pemanggil,
+        // 0 = hardware_concurrency. Dengan satu worker tiling tidak diaktifkan:
+        // binning per tile cuma overhead di atas flush serial.
+        void set_tiled(bool enabled, int tile_size = 64, unsigned threads = 0)
+            requires TileBackend<Backend>
+        {
+            flush();
+            unsigned wanted = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+            if (!enabled || wanted < 2) {
+                tiles_.reset();
+                return;
+            }
+            tile_size = std::max(tile_size, 8);
+            if (!tiles_ || tiles_->pool.size() != wanted) {
+                tiles_ = std::make_unique<TileState>(wanted, tile_size);
+            }
+            tiles_->tile_size = tile_size;
+        }
+
+        bool is_tiled() const noexcept {
+            return tiles_ != nullptr;
+        }
+
+        // Basic drawing operations
+        void clear(ColorU8 color) override {
+            flush();
+            ++this->frame_stats_.draw_calls;
+            ++this->frame_stats_.submitted_draw_calls;
+            Backend::clear(color);
+        }
+
+        void draw_line(
+            const basic_point<float>& start,
+            const basic_point<float>& end,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!recording()) return direct([&] { Backend::draw_line(start, end, color, width); });
+
+            Item item{};
+            item.kind = Kind::Line;
+            item.color = color;
+            item.width = width;
+            item.start = bake(start);
+            item.end = bake(end);
+            item.bounds = bounds_of(item.start.x, item.start.y, item.end.x, item.end.y, width);
+            enqueue(item);
+        }
+
+        void draw_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!recording()) return direct([&] { Backend::draw_rect(rect, color, width); });
+
+            Item item{};
+            item.kind = Kind::DrawRect;
+            item.color = color;
+            item.width = width;
+            item.rect = bake(rect);
+            item.bounds = bounds_of(item.rect, width);
+            enqueue(item);
+        }
+
+        void fill_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color
+        ) override {
+            if (!recording()) return direct([&] { Backend::fill_rect(rect, color); });
+
+            Item item{};
+            item.kind = Kind::FillRect;
+            item.color = color;
+            item.rect = bake(rect);
+            item.bounds = bounds_of(item.rect, 0.0f);
+            enqueue(item);
+        }
+
+        void draw_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::draw_rounded_rect(rect, radius_x, radius_y, color, width); });
+            }
+
+            Item item{};
+            item.kind = Kind::DrawRoundedRect;
+            item.color = color;
+            item.width = width;
+            item.rect = bake(rect);
+            item.radius_x = radius_x;
+            item.radius_y = radius_y;
+            item.bounds = bounds_of(item.rect, width);
+            enqueue(item);
+        }
+
+        void fill_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::fill_rounded_rect(rect, radius_x, radius_y, color); });
+            }
+
+            Item item{};
+            item.kind = Kind::FillRoundedRect;
+            item.color = color;
+            item.rect = bake(rect);
+            item.radius_x = radius_x;
+            item.radius_y = radius_y;
+            item.bounds = bounds_of(item.rect, 0.0f);
+            enqueue(item);
+        }
+
+        void draw_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::draw_ellipse(center, radius_x, radius_y, color, width); });
+            }
+
+            basic_point<float> c = bake(center);
+            Item item{};
+            item.kind = Kind::DrawEllipse;
+            item.color = color;
+            item.width = width;
+            item.rect = basic_rect<float>(c.x, c.y, radius_x, radius_y);
+            item.bounds = bounds_of(c.x - radius_x, c.y - radius_y, c.x + radius_x, c.y + radius_y, width);
+            enqueue(item);
+        }
+
+        void fill_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::fill_ellipse(center, radius_x, radius_y, color); });
+            }
+
+            basic_point<float> c = bake(center);
+            Item item{};
+            item.kind = Kind::FillEllipse;
+            item.color = color;
+            item.rect = basic_rect<float>(c.x, c.y, radius_x, radius_y);
+            item.bounds = bounds_of(c.x - radius_x, c.y - radius_y, c.x + radius_x, c.y + radius_y, 0.0f);
+            enqueue(item);
+        }
+
+        void draw_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::draw_text(text, rect, color, text_format); });
+            }
+            enqueue_text(Kind::Text, text, rect, color, text_format);
+        }
+
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::draw_cached_text(text, rect, color, text_format); });
+            }
+            enqueue_text(Kind::CachedText, text, rect, color, text_format);
+        }
+
+        void fill_path(
+            const Path& path,
+            ColorU8 color,
+            FillRule rule = FillRule::NonZero,
+            const Transform& transform = Transform::identity()
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::fill_path(path, color, rule, transform); });
+            }
+            if (path.empty()) return;
+
+            Item item{};
+            item.kind = Kind::FillPath;
+            item.color = color;
+            item.rule = rule;
+            item.transform = transform * this->transform_;
+            item.bounds = path_bounds_of(path, item.transform, nullptr);
+            item.text_index = store_path(path);
+            enqueue(item);
+        }
+
+        void stroke_path(
+            const Path& path,
+            ColorU8 color,
+            const StrokeStyle& style = StrokeStyle{},
+            const Transform& transform = Transform::identity()
+        ) override {
+            if (!recording()) {
+                return direct([&] { Backend::stroke_path(path, color, style, transform); });
+            }
+            if (path.empty()) return;
+
+            Item item{};
+            item.kind = Kind::StrokePath;
+            item.color = color;
+            item.width = style.width;
+            item.stroke = style;
+            item.transform = transform * this->transform_;
+            item.bounds = path_bounds_of(path, item.transform, &style);
+            item.text_index = store_path(path);
+            enqueue(item);
+        }
+
+        // Batch primitive dari widget: tiap elemen ikut di-sort bersama
+        // primitive lain di frame ini; tanpa batching diteruskan utuh
+        void fill_rects(std::span<const basic_rect<float>> rects, ColorU8 color) override {
+            if (!recording()) return direct(rects.size(), [&] { Backend::fill_rects(rects, color); });
+            for (const auto& rect : rects) {
+                fill_rect(rect, color);
+            }
+        }
+
+        void draw_rects(std::span<const basic_rect<float>> rects, ColorU8 color, float width = 1.0f) override {
+            if (!recording()) return direct(rects.size(), [&] { Backend::draw_rects(rects, color, width); });
+            for (const auto& rect : rects) {
+                draw_rect(rect, color, width);
+            }
+        }
+
+        void fill_rects(std::span<const RectColor> rects) override {
+            if (!recording()) return direct(rects.size(), [&] { Backend::fill_rects(rects); });
+            for (const auto& r : rects) {
+                fill_rect(r.rect, r.color);
+            }
+        }
+
+        void draw_lines(std::span<const LineSeg> lines) override {
+            if (!recording()) return direct(lines.size(), [&] { Backend::draw_lines(lines); });
+            for (const auto& l : lines) {
+                draw_line(l.start, l.end, l.color, l.width);
+            }
+        }
+
+        void fill_rounded_rects(std::span<const RoundedRectColor> rects) override {
+            if (!recording()) return direct(rects.size(), [&] { Backend::fill_rounded_rects(rects); });
+            for (const auto& r : rects) {
+                fill_rounded_rect(r.rect, r.radius_x, r.radius_y, r.color);
+            }
+        }
+
+        // Layer = canvas backend terpisah, item tertunda tidak menyentuhnya:
+        // tidak perlu flush. draw_layer yang flush sebelum komposit supaya
+        // urutan dengan item sebelumnya tetap.
+        std::unique_ptr<Canvas> create_layer(const basic_rect<int>& bounds) override {
+            use_backend_transform(this->transform_);
+            return Backend::create_layer(bounds);
+        }
+
+        bool draw_layer(Canvas& layer, const basic_rect<int>& bounds) override {
+            flush();
+            use_backend_transform(this->transform_);
+            ++this->frame_stats_.draw_calls;
+            ++this->frame_stats_.submitted_draw_calls;
+            return Backend::draw_layer(layer, bounds);
+        }
+
+        // Blit di device space; item tertunda harus sudah di framebuffer
+        bool scroll_rect(const basic_rect<int>& area, int dx, int dy) override {
+            flush();
+            return Backend::scroll_rect(area, dx, dy);
+        }
+
+        // Perubahan clip memotong batch. Clip ikut transform logis: saat
+        // translasi, rect digeser di sini dan backend tetap identity.
+        void push_clip(const basic_rect<float>& rect) override {
+            flush();
+            if (this->transform_.is_translation()) {
+                use_backend_transform(Transform::identity());
+                Backend::push_clip(bake(rect));
+            } else {
+                use_backend_transform(this->transform_);
+                Backend::push_clip(rect);
+            }
+        }
+
+        void push_clip_region(const Region& region) override {
+            flush();
+            use_backend_transform(this->transform_);
+            Backend::push_clip_region(region);
+        }
+
+        void pop_clip() override {
+            flush();
+            Backend::pop_clip();
+        }
+
+        // Transform tidak memotong batch: hanya dicatat, item berikutnya
+        // yang menerapkannya (lihat recording())
+        void set_transform(const Transform& transform) override {
+            this->transform_ = transform;
+        }
+
+    private:
+        void reset_items() noexcept {
+            items_.clear();
+            batches_.clear();
+            string_count_ = 0;
+            path_count_ = 0;
+        }
+
+        // Bin item (urutan hasil sort, sudah benar per piksel) ke tile yang
+        // disentuh bounds-nya, lalu raster tiap tile non-kosong secara paralel
+        void flush_tiled() requires TileBackend<Backend> {
+            TileState& state = *tiles_;
+            basic_rect<int> clip = Backend::get_clip();
+            int size = state.tile_size;
+            int columns = (clip.w + size - 1) / size;
+            int rows = (clip.h + size - 1) / size;
+
+            auto& stats = this->frame_stats_;
+            stats.submitted_draw_calls += static_cast<uint32_t>(sorted_.size());
+            stats.batches += static_cast<uint32_t>(batches_.size());
+            if (columns <= 0 || rows <= 0) return;
+
+            state.bins.resize(static_cast<size_t>(columns) * rows);
+            for (auto& bin : state.bins) bin.clear();
+
+            for (size_t i = 0; i < sorted_.size(); ++i) {
+                const Bounds& b = sorted_[i].bounds;
+                int x0 = std::max(static_cast<int>(b.x0) - clip.x, 0);
+                int y0 = std::max(static_cast<int>(b.y0) - clip.y, 0);
+                int x1 = std::min(static_cast<int>(b.x1) - clip.x, clip.w);
+                int y1 = std::min(static_cast<int>(b.y1) - clip.y, clip.h);
+                if (x1 <= x0 || y1 <= y0) continue;
+
+                for (int ty = y0 / size; ty <= (y1 - 1) / size; ++ty) {
+                    for (int tx = x0 / size; tx <= (x1 - 1) / size; ++tx) {
+                        state.bins[static_cast<size_t>(ty) * columns + tx].push_back(static_cast<uint32_t>(i));
+                    }
+                }
+            }
+
+            state.active.clear();
+            for (size_t t = 0; t < state.bins.size(); ++t) {
+                if (!state.bins[t].empty()) state.active.push_back(static_cast<uint32_t>(t));
+            }
+
+            state.pool.run(state.active.size(), [&](size_t task, unsigned worker) {
+                uint32_t t = state.active[task];
+                int tx = static_cast<int>(t % columns), ty = static_cast<int>(t / columns);
+                basic_rect<int> tile(clip.x + tx * size, clip.y + ty * size, size, size);
+
+                Backend& view = state.views[worker];
+                view.attach_tile(*this, tile);
+                for (uint32_t index : state.bins[t]) {
+                    submit_one(view, sorted_[index]);
+                }
+            });
+            stats.tiles += static_cast<uint32_t>(state.active.size());
+
+            for (auto& view : state.views) {
+                FrameStats& local = view.get_frame_stats();
+                stats.path_cache_hits += local.path_cache_hits;
+                stats.path_cache_misses += local.path_cache_misses;
+                stats.text_layout_hits += local.text_layout_hits;
+                stats.text_layout_misses += local.text_layout_misses;
+                local.reset();
+            }
+        }
+
+        // Tanpa rekaman: item tertunda dikirim dulu supaya urutan tetap,
+        // lalu primitive digambar backend dengan transform logis
+        template <typename Fn>
+        void direct(Fn&& fn) {
+            direct(1, std::forward<Fn>(fn));
+        }
+
+        template <typename Fn>
+        void direct(size_t count, Fn&& fn) {
+            flush();
+            use_backend_transform(this->transform_);
+            passthrough(count, std::forward<Fn>(fn));
+        }
+
+        // Satu submission ke backend untuk count primitive
+        template <typename Fn>
+        void passthrough(size_t count, Fn&& fn) {
+            if (count == 0) return;
+            this->frame_stats_.draw_calls += static_cast<uint32_t>(count);
+            ++this->frame_stats_.submitted_draw_calls;
+            fn();
+        }
+    };
+
+} // namespace zuu::widget
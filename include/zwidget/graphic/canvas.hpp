@@ -1,27 +1,160 @@
 #pragma once
 
 #include "color.hpp"
-#include <d2d1.h>
-#include <dwrite.h>
-#include <wrl/client.h>
-
-#ifdef min
-	#undef min
-#endif
-#ifdef max
-	#undef max
-#endif
-
+#include "frame_stats.hpp"
+#include "path.hpp"
+#include "region.hpp"
+#include "text_format.hpp"
+#include "transform.hpp"
 #include "zwidget/unit/rect.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace zuu::widget {
 
-    // Canvas adalah abstraksi untuk drawing operations
+    // Elemen untuk batch primitive (fill_rects / draw_lines / fill_rounded_rects)
+    struct RectColor {
+        basic_rect<float> rect;
+        ColorU8 color;
+    };
+
+    struct LineSeg {
+        basic_point<float> start;
+        basic_point<float> end;
+        ColorU8 color;
+        float width{1.0f};
+    };
+
+    struct RoundedRectColor {
+        basic_rect<float> rect;
+        float radius_x{0.0f};
+        float radius_y{0.0f};
+        ColorU8 color;
+    };
+
+    // Canvas adalah abstraksi untuk drawing operations.
+    // Backend konkret: D2DCanvas (Win32) dan SoftwareCanvas (CPU, portable).
     class Canvas {
     protected:
-        Microsoft::WRL::ComPtr<ID2D1RenderTarget> render_target_;
-        Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> brush_;
+        // Damage frame yang sedang dicat (milik Renderer); nullptr = full repaint
+        const Region* damage_{nullptr};
+        FrameStats frame_stats_;
+
+        // Koordinat user -> device. Damage dan clip_depth() di device space.
+        struct SavedState {
+            Transform transform;
+            size_t clip_depth;
+        };
+
+        Transform transform_;
+        std::vector<SavedState> state_stack_;
+
+        // Clip efektif (irisan seluruh stack, bounding box, device space)
+        // per kedalaman clip; kosong = tanpa clip. Backend meng-update lewat
+        // track_clip / untrack_clip supaya primitive di luar clip bisa
+        // ditolak sebelum update brush / rasterisasi (cull).
+        std::vector<basic_rect<float>> clip_bounds_;
+
+        // Bounding box rect setelah transform (axis-aligned)
+        static basic_rect<float> map_rect(const Transform& transform, const basic_rect<float>& rect) noexcept {
+            if (transform.is_translation()) {
+                return basic_rect<float>(rect.x + transform.dx, rect.y + transform.dy, rect.w, rect.h);
+            }
+            basic_point<float> corners[] = {
+                transform.apply(basic_point<float>(rect.x, rect.y)),
+                transform.apply(basic_point<float>(rect.x + rect.w, rect.y)),
+                transform.apply(basic_point<float>(rect.x, rect.y + rect.h)),
+                transform.apply(basic_point<float>(rect.x + rect.w, rect.y + rect.h))
+            };
+            float x0 = corners[0].x, y0 = corners[0].y, x1 = x0, y1 = y0;
+            for (const auto& c : corners) {
+                x0 = std::min(x0, c.x);
+                y0 = std::min(y0, c.y);
+                x1 = std::max(x1, c.x);
+                y1 = std::max(y1, c.y);
+            }
+            return basic_rect<float>(x0, y0, x1 - x0, y1 - y0);
+        }
+
+        basic_rect<float> map_rect(const basic_rect<float>& rect) const noexcept {
+            return map_rect(transform_, rect);
+        }
+
+        // Push clip device space; dibulatkan keluar ke piksel supaya tidak
+        // pernah lebih sempit dari clip backend (antialiased atau tidak)
+        void track_clip(const basic_rect<float>& device) {
+            float x0 = std::floor(device.x), y0 = std::floor(device.y);
+            float x1 = std::ceil(device.x + device.w), y1 = std::ceil(device.y + device.h);
+            if (!clip_bounds_.empty()) {
+                const auto& top = clip_bounds_.back();
+                x0 = std::max(x0, top.x);
+                y0 = std::max(y0, top.y);
+                x1 = std::min(x1, top.x + top.w);
+                y1 = std::min(y1, top.y + top.h);
+            }
+            clip_bounds_.push_back(basic_rect<float>(x0, y0, std::max(0.0f, x1 - x0), std::max(0.0f, y1 - y0)));
+        }
+
+        void untrack_clip() noexcept {
+            if (!clip_bounds_.empty()) clip_bounds_.pop_back();
+        }
+
+        static bool outside(const basic_rect<float>& rect, const basic_rect<float>& clip) noexcept {
+            return clip.w <= 0.0f || clip.h <= 0.0f
+                || rect.x >= clip.x + clip.w || rect.x + rect.w <= clip.x
+                || rect.y >= clip.y + clip.h || rect.y + rect.h <= clip.y;
+        }
+
+        // True kalau primitive (bounds device space, sudah termasuk stroke
+        // dan antialiasing) seluruhnya di luar clip; dihitung di frame stats
+        bool cull(const basic_rect<float>& device) noexcept {
+            if (clip_bounds_.empty() || !outside(device, clip_bounds_.back())) return false;
+            ++frame_stats_.culled_draw_calls;
+            return true;
+        }
+
+        // Bounds konservatif primitive (koordinat user): stroke setengah
+        // lebar di tiap sisi plus 1px untuk antialiasing / garis hairline
+        static basic_rect<float> stroke_bounds(float x0, float y0, float x1, float y1, float width) noexcept {
+            float pad = std::max(width, 1.0f) * 0.5f + 1.0f;
+            float left = std::min(x0, x1), top = std::min(y0, y1);
+            return basic_rect<float>(
+                left - pad, top - pad, std::max(x0, x1) - left + pad * 2.0f, std::max(y0, y1) - top + pad * 2.0f);
+        }
+
+        // Teks bisa keluar dari layout box (wrap, kata panjang). Perkiraan
+        // konservatif: jumlah baris dihitung dengan advance 1em (glyph font
+        // asli bisa selebar 'W'), line height 1.35em (>= Segoe UI ascent +
+        // descent di DirectWrite, >= 1.3em placeholder SoftwareCanvas), plus
+        // 0.25em di atas untuk aksen di atas ascent.
+        static basic_rect<float> text_bounds(const std::wstring& text, const basic_rect<float>& rect, float size) noexcept {
+            float advance = size;
+            float line_height = size * 1.35f;
+            float per_line = std::max(1.0f, std::floor(rect.w / advance));
+            float lines = std::ceil(static_cast<float>(text.size()) / per_line)
+                + static_cast<float>(std::count(text.begin(), text.end(), L'\n'));
+
+            float pad = size * 0.25f;
+            float w = std::max(rect.w, static_cast<float>(text.size()) * size);
+            float h = std::max(rect.h, lines * line_height) + pad;
+            return basic_rect<float>(rect.x, rect.y - pad, w, h);
+        }
+
+        // Bounds titik kontrol setelah transform; stroke diperlebar sampai
+        // ujung miter / cap square terjauh
+        static basic_rect<float> path_bounds(const Path& path, const Transform& transform, const StrokeStyle* stroke) noexcept {
+            basic_rect<float> r = map_rect(transform, path.bounds());
+            float width = 0.0f;
+            if (stroke) {
+                float reach = stroke->join == LineJoin::Miter ? std::max(stroke->miter_limit, 1.5f) : 1.5f;
+                width = stroke->width * transform.max_scale() * reach;
+            }
+            return stroke_bounds(r.x, r.y, r.x + r.w, r.y + r.h, width);
+        }
 
     public:
         Canvas() = default;
@@ -33,133 +166,60 @@ namespace zuu::widget {
         Canvas& operator=(Canvas&&) = default;
 
         // Basic drawing operations
-        virtual void clear(const Color& color) {
-            if (render_target_) {
-                render_target_->Clear(color.to_d2d());
-            }
-        }
+        virtual void clear(ColorU8) {}
 
         virtual void draw_line(
-            const basic_point<float>& start,
-            const basic_point<float>& end,
-            const Color& color,
-            float width = 1.0f
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->DrawLine(
-                D2D1::Point2F(start.x, start.y),
-                D2D1::Point2F(end.x, end.y),
-                brush_.Get(),
-                width
-            );
-        }
+            const basic_point<float>&,
+            const basic_point<float>&,
+            ColorU8,
+            float = 1.0f
+        ) {}
 
         virtual void draw_rect(
-            const basic_rect<float>& rect,
-            const Color& color,
-            float width = 1.0f
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->DrawRectangle(
-                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                brush_.Get(),
-                width
-            );
-        }
+            const basic_rect<float>&,
+            ColorU8,
+            float = 1.0f
+        ) {}
 
         virtual void fill_rect(
-            const basic_rect<float>& rect,
-            const Color& color
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->FillRectangle(
-                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                brush_.Get()
-            );
-        }
+            const basic_rect<float>&,
+            ColorU8
+        ) {}
 
         virtual void draw_rounded_rect(
-            const basic_rect<float>& rect,
-            float radius_x,
-            float radius_y,
-            const Color& color,
-            float width = 1.0f
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->DrawRoundedRectangle(
-                D2D1::RoundedRect(
-                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                    radius_x,
-                    radius_y
-                ),
-                brush_.Get(),
-                width
-            );
-        }
+            const basic_rect<float>&,
+            float,
+            float,
+            ColorU8,
+            float = 1.0f
+        ) {}
 
         virtual void fill_rounded_rect(
-            const basic_rect<float>& rect,
-            float radius_x,
-            float radius_y,
-            const Color& color
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->FillRoundedRectangle(
-                D2D1::RoundedRect(
-                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                    radius_x,
-                    radius_y
-                ),
-                brush_.Get()
-            );
-        }
+            const basic_rect<float>&,
+            float,
+            float,
+            ColorU8
+        ) {}
 
         virtual void draw_ellipse(
-            const basic_point<float>& center,
-            float radius_x,
-            float radius_y,
-            const Color& color,
-            float width = 1.0f
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->DrawEllipse(
-                D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius_x, radius_y),
-                brush_.Get(),
-                width
-            );
-        }
+            const basic_point<float>&,
+            float,
+            float,
+            ColorU8,
+            float = 1.0f
+        ) {}
 
         virtual void fill_ellipse(
-            const basic_point<float>& center,
-            float radius_x,
-            float radius_y,
-            const Color& color
-        ) {
-            if (!render_target_ || !brush_) return;
-
-            brush_->SetColor(color.to_d2d());
-            render_target_->FillEllipse(
-                D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius_x, radius_y),
-                brush_.Get()
-            );
-        }
+            const basic_point<float>&,
+            float,
+            float,
+            ColorU8
+        ) {}
 
         virtual void draw_circle(
             const basic_point<float>& center,
             float radius,
-            const Color& color,
+            ColorU8 color,
             float width = 1.0f
         ) {
             draw_ellipse(center, radius, radius, color, width);
@@ -168,66 +228,254 @@ namespace zuu::widget {
         virtual void fill_circle(
             const basic_point<float>& center,
             float radius,
-            const Color& color
+            ColorU8 color
         ) {
             fill_ellipse(center, radius, radius, color);
         }
 
-        // Text rendering (simplified - can be extended)
+        // Batch satu warna: satu submission ke backend (satu SetColor di D2D)
+        virtual void fill_rects(std::span<const basic_rect<float>> rects, ColorU8 color) {
+            for (const auto& rect : rects) {
+                fill_rect(rect, color);
+            }
+        }
+
+        virtual void draw_rects(std::span<const basic_rect<float>> rects, ColorU8 color, float width = 1.0f) {
+            for (const auto& rect : rects) {
+                draw_rect(rect, color, width);
+            }
+        }
+
+        // Batch multi-warna: satu virtual call untuk seluruh list; backend
+        // cukup update brush saat warna berganti
+        virtual void fill_rects(std::span<const RectColor> rects) {
+            for (const auto& r : rects) {
+                fill_rect(r.rect, r.color);
+            }
+        }
+
+        virtual void draw_lines(std::span<const LineSeg> lines) {
+            for (const auto& l : lines) {
+                draw_line(l.start, l.end, l.color, l.width);
+            }
+        }
+
+        virtual void fill_rounded_rects(std::span<const RoundedRectColor> rects) {
+            for (const auto& r : rects) {
+                fill_rounded_rect(r.rect, r.radius_x, r.radius_y, r.color);
+            }
+        }
+
+        // Path: geometri dalam koordinat user, transform diterapkan per call.
+        // Backend meng-cache hasil tessellation per path + transform.
+        virtual void fill_path(
+            const Path&,
+            ColorU8,
+            FillRule = FillRule::NonZero,
+            const Transform& = Transform::identity()
+        ) {}
+
+        virtual void stroke_path(
+            const Path&,
+            ColorU8,
+            const StrokeStyle& = StrokeStyle{},
+            const Transform& = Transform::identity()
+        ) {}
+
+        // Text rendering. text_format == nullptr berarti pakai format default
+        // milik backend (kalau ada).
         virtual void draw_text(
+            const std::wstring&,
+            const basic_rect<float>&,
+            ColorU8,
+            TextFormat* = nullptr
+        ) {}
+
+        // Teks yang digambar ulang tiap frame tanpa berubah (label, caption).
+        // Backend boleh meng-cache layout-nya per (teks, format, lebar box);
+        // default sama dengan draw_text.
+        virtual void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) {
+            draw_text(text, rect, color, text_format);
+        }
+
+        // Bounds (koordinat sama dengan rect) yang disentuh draw_cached_text,
+        // untuk culling / batching. Default perkiraan text_bounds; backend
+        // dengan layout cache mengembalikan bounds tinta layout-nya.
+        virtual basic_rect<float> cached_text_bounds(
             const std::wstring& text,
             const basic_rect<float>& rect,
-            const Color& color,
-            IDWriteTextFormat* text_format = nullptr
+            TextFormat* text_format = nullptr
         ) {
-            if (!render_target_ || !brush_ || !text_format) return;
+            return text_bounds(text, rect, text_format_size(text_format));
+        }
+
+        // Ukur teks sebagai satu baris. advances (kalau tidak null) diisi
+        // advance per code unit, termasuk kerning ke unit berikutnya; unit
+        // lanjutan (low surrogate, sisa cluster) 0. Default: estimasi
+        // monospace placeholder, backend dengan font meng-override.
+        virtual TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) {
+            float size = text_format_size(text_format);
+            if (advances) advances->assign(text.size(), size * 0.55f);
+            return TextMetrics{static_cast<float>(text.size()) * size * 0.55f, size, size * 0.3f, size * 1.3f};
+        }
 
-            brush_->SetColor(color.to_d2d());
-            render_target_->DrawText(
-                text.c_str(),
-                static_cast<UINT32>(text.length()),
-                text_format,
-                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                brush_.Get()
-            );
+        // Caret terdekat dari x (relatif awal teks) lewat measure_text +
+        // binary search. Widget yang hit test berulang (TextBox) sebaiknya
+        // menyimpan prefix sum sendiri dan memakai hit_test_carets.
+        TextHit hit_test_text(const std::wstring& text, float x, TextFormat* text_format = nullptr) {
+            std::vector<float> carets;
+            measure_text(text, text_format, &carets);
+            carets.insert(carets.begin(), 0.0f);
+            for (size_t i = 1; i < carets.size(); ++i) carets[i] += carets[i - 1];
+            return hit_test_carets(carets, x);
         }
 
         // Clipping
-        virtual void push_clip(const basic_rect<float>& rect) {
-            if (!render_target_) return;
+        virtual void push_clip(const basic_rect<float>&) {}
+        virtual void pop_clip() {}
+
+        // Clip ke gabungan box region; di-pop dengan pop_clip() biasa.
+        // Default: bounding box region (backend tanpa clip non-rect).
+        virtual void push_clip_region(const Region& region) {
+            basic_rect<int> b = region.bounds();
+            push_clip(basic_rect<float>(
+                static_cast<float>(b.x),
+                static_cast<float>(b.y),
+                static_cast<float>(b.w),
+                static_cast<float>(b.h)
+            ));
+        }
+
+        // Layer offscreen (WidgetFlag::CacheAsLayer). create_layer membuat
+        // canvas transparan seukuran bounds yang menerima koordinat canvas ini
+        // apa adanya; draw_layer mengomposit (source-over) layer buatan backend
+        // yang sama ke bounds. nullptr / false = backend tidak punya layer,
+        // widget digambar langsung.
+        virtual std::unique_ptr<Canvas> create_layer(const basic_rect<int>&) {
+            return nullptr;
+        }
+
+        virtual bool draw_layer(Canvas&, const basic_rect<int>&) {
+            return false;
+        }
+
+        // Device pemilik resource layer: layer hanya bisa dikomposit ke
+        // canvas dengan device yang sama, dan dilepas bersama device itu.
+        // nullptr = layer tidak terikat device (memori biasa).
+        virtual const void* layer_device() const noexcept {
+            return nullptr;
+        }
+
+        // Geser piksel yang sudah ada di area (device space, tanpa clip /
+        // transform) sejauh (dx, dy); bagian area yang terbuka dibiarkan
+        // apa adanya. false = backend tidak bisa blit, area harus di-repaint.
+        virtual bool scroll_rect(const basic_rect<int>&, int, int) {
+            return false;
+        }
+
+        // Damage culling
+        void set_damage(const Region* damage) noexcept {
+            damage_ = damage;
+        }
+
+        const Region* get_damage() const noexcept {
+            return damage_;
+        }
+
+        // False kalau rect (koordinat user, dibulatkan keluar ke piksel) tidak
+        // menyentuh damage frame ini, jadi widget di dalamnya boleh dilewati
+        bool needs_paint(const basic_rect<float>& r) const noexcept {
+            if (!damage_) return true;
+
+            basic_rect<float> rect = transform_.is_identity() ? r : map_rect(r);
+            int x0 = static_cast<int>(std::floor(rect.x));
+            int y0 = static_cast<int>(std::floor(rect.y));
+            int x1 = static_cast<int>(std::ceil(rect.x + rect.w));
+            int y1 = static_cast<int>(std::ceil(rect.y + rect.h));
+            return damage_->intersects(basic_rect<int>(x0, y0, x1 - x0, y1 - y0));
+        }
 
-            render_target_->PushAxisAlignedClip(
-                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
-                D2D1_ANTIALIAS_MODE_PER_PRIMITIVE
-            );
+        // True kalau rect (koordinat user) pasti tidak terlihat karena di
+        // luar clip aktif; widget bisa memakainya untuk melewati item list /
+        // teks yang di-scroll keluar sebelum menyusun primitive
+        bool quick_reject(const basic_rect<float>& rect) const noexcept {
+            if (clip_bounds_.empty()) return false;
+            return outside(transform_.is_identity() ? rect : map_rect(rect), clip_bounds_.back());
         }
 
-        virtual void pop_clip() {
-            if (!render_target_) return;
-            render_target_->PopAxisAlignedClip();
+        FrameStats& get_frame_stats() noexcept {
+            return frame_stats_;
         }
 
-        // Transform operations
+        const FrameStats& get_frame_stats() const noexcept {
+            return frame_stats_;
+        }
+
+        // State stack: save() menyimpan transform dan kedalaman clip;
+        // restore() mem-pop clip yang di-push setelahnya lalu mengembalikan
+        // transform. Harus berpasangan.
         virtual void save() {
-            // Can be extended for state saving
+            state_stack_.push_back(SavedState{transform_, clip_depth()});
         }
 
         virtual void restore() {
-            // Can be extended for state restoration
+            if (state_stack_.empty()) return;
+            SavedState state = state_stack_.back();
+            state_stack_.pop_back();
+            while (clip_depth() > state.clip_depth) {
+                pop_clip();
+            }
+            if (!(state.transform == transform_)) {
+                set_transform(state.transform);
+            }
+        }
+
+        // Transform absolut user -> device. Backend meng-override untuk
+        // menerapkannya; translasi integer adalah jalur cepat di semua backend.
+        virtual void set_transform(const Transform& transform) {
+            transform_ = transform;
+        }
+
+        const Transform& get_transform() const noexcept {
+            return transform_;
+        }
+
+        // Transform baru diterapkan ke koordinat user lebih dulu, lalu
+        // transform yang sudah ada (seperti CanvasRenderingContext2D)
+        void concat(const Transform& transform) {
+            set_transform(transform * transform_);
+        }
+
+        void translate(float dx, float dy) {
+            if (dx == 0.0f && dy == 0.0f) return;
+            concat(Transform::translation(dx, dy));
+        }
+
+        void scale(float sx, float sy) {
+            concat(Transform::scale(sx, sy));
         }
 
-        // Getters
-        ID2D1RenderTarget* get_render_target() const noexcept {
-            return render_target_.Get();
+        void rotate(float radians) {
+            concat(Transform::rotation(radians));
         }
 
-        ID2D1SolidColorBrush* get_brush() const noexcept {
-            return brush_.Get();
+        // Jumlah clip aktif (push_clip / push_clip_region belum di-pop)
+        virtual size_t clip_depth() const noexcept {
+            return 0;
         }
 
-        bool is_valid() const noexcept {
-            return render_target_ != nullptr && brush_ != nullptr;
+        virtual bool is_valid() const noexcept {
+            return false;
         }
     };
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
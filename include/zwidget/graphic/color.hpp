@@ -1,7 +1,18 @@
 #pragma once
 
+#include "zwidget/detail/platform.hpp"
 #include <cstdint>
-#include <d2d1.h>
+
+#if ZWIDGET_PLATFORM_WIN32
+    #include <d2d1.h>
+
+    #ifdef min
+        #undef min
+    #endif
+    #ifdef max
+        #undef max
+    #endif
+#endif
 
 namespace zuu::widget {
 
@@ -44,15 +55,19 @@ namespace zuu::widget {
             );
         }
 
+#if ZWIDGET_PLATFORM_WIN32
         constexpr D2D1_COLOR_F to_d2d() const noexcept {
             return D2D1::ColorF(r_, g_, b_, a_);
         }
+#endif
 
         constexpr float r() const noexcept { return r_; }
         constexpr float g() const noexcept { return g_; }
         constexpr float b() const noexcept { return b_; }
         constexpr float a() const noexcept { return a_; }
 
+        constexpr bool operator==(const Color&) const noexcept = default;
+
         constexpr void set_r(float r) noexcept { r_ = r; }
         constexpr void set_g(float g) noexcept { g_ = g; }
         constexpr void set_b(float b) noexcept { b_ = b; }
@@ -72,4 +87,86 @@ namespace zuu::widget {
         static consteval Color DarkGray() noexcept { return Color(0.25f, 0.25f, 0.25f); }
     };
 
+    // ColorU8 - warna packed 4 byte, premultiplied, dibaca sebagai uint32_t
+    // 0xAARRGGBB (layout PixelFormat::Bgra8). Format simpan untuk style widget
+    // dan parameter draw call: murah di-copy, dan backend software cukup
+    // swizzle tanpa matematika float. Color (float, straight alpha) tetap
+    // dipakai untuk menghitung warna; konversinya implisit.
+    class ColorU8 {
+    private:
+        uint32_t value_{0};
+
+        static constexpr uint32_t mul_div255(uint32_t a, uint32_t b) noexcept {
+            uint32_t t = a * b + 128;
+            return (t + (t >> 8)) >> 8;
+        }
+
+        static constexpr uint32_t to_byte(float v) noexcept {
+            v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+            return static_cast<uint32_t>(v * 255.0f + 0.5f);
+        }
+
+        static constexpr ColorU8 premultiply(uint32_t r, uint32_t g, uint32_t b, uint32_t a) noexcept {
+            return from_premultiplied(
+                (a << 24) | (mul_div255(r, a) << 16) | (mul_div255(g, a) << 8) | mul_div255(b, a));
+        }
+
+    public:
+        constexpr ColorU8() noexcept = default;
+
+        // Pembulatan sama persis dengan jalur float lama (clamp, *255, round,
+        // lalu premultiply), jadi pixel SoftwareCanvas tidak berubah
+        constexpr ColorU8(const Color& color) noexcept
+            : value_(premultiply(to_byte(color.r()), to_byte(color.g()), to_byte(color.b()), to_byte(color.a())).value_) {}
+
+        static constexpr ColorU8 from_premultiplied(uint32_t argb) noexcept {
+            ColorU8 color;
+            color.value_ = argb;
+            return color;
+        }
+
+        // Channel straight alpha
+        static constexpr ColorU8 from_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) noexcept {
+            return premultiply(r, g, b, a);
+        }
+
+        // 0xRRGGBB, atau 0xAARRGGBB kalau > 0xFFFFFF (sama dengan Color::from_hex)
+        static constexpr ColorU8 from_hex(uint32_t hex) noexcept {
+            uint32_t a = hex > 0xFFFFFF ? (hex >> 24) & 0xFF : 0xFF;
+            return premultiply((hex >> 16) & 0xFF, (hex >> 8) & 0xFF, hex & 0xFF, a);
+        }
+
+        constexpr uint32_t value() const noexcept { return value_; }
+
+        // Channel premultiplied
+        constexpr uint8_t r() const noexcept { return static_cast<uint8_t>(value_ >> 16); }
+        constexpr uint8_t g() const noexcept { return static_cast<uint8_t>(value_ >> 8); }
+        constexpr uint8_t b() const noexcept { return static_cast<uint8_t>(value_); }
+        constexpr uint8_t a() const noexcept { return static_cast<uint8_t>(value_ >> 24); }
+
+        constexpr bool is_opaque() const noexcept { return a() == 255; }
+        constexpr bool is_transparent() const noexcept { return value_ == 0; }
+
+        // Kembali ke float straight alpha; alpha 0 jadi hitam transparan
+        constexpr Color to_color() const noexcept {
+            uint32_t alpha = a();
+            if (alpha == 0) return Color(0.0f, 0.0f, 0.0f, 0.0f);
+            float inv = 1.0f / static_cast<float>(alpha);
+            return Color(
+                static_cast<float>(r()) * inv,
+                static_cast<float>(g()) * inv,
+                static_cast<float>(b()) * inv,
+                static_cast<float>(alpha) / 255.0f
+            );
+        }
+
+#if ZWIDGET_PLATFORM_WIN32
+        constexpr D2D1_COLOR_F to_d2d() const noexcept {
+            return to_color().to_d2d();
+        }
+#endif
+
+        constexpr bool operator==(const ColorU8&) const noexcept = default;
+    };
+
 } // namespace zuu::widget
\ No newline at end of file
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "color.hpp"
+#include "span_kernels.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace zuu::widget {
+
+    // Konversi warna per batch (palet, style, buffer gambar). Hasil SIMD identik
+    // bit dengan jalur scalar, yang sendiri identik dengan konversi per warna
+    // di ColorU8.
+    //  pack          - Color (float, straight) -> ColorU8
+    //  unpack        - ColorU8 -> Color (sama dengan ColorU8::to_color)
+    //  premultiply   - RGBA8 straight -> premultiplied, alpha di byte 3
+    //  unpremultiply - kebalikannya, round(c * 255 / a)
+    struct ColorConvertKernels {
+        SimdLevel level;
+        void (*pack)(const Color* src, ColorU8* dst, size_t count) noexcept;
+        void (*unpack)(const ColorU8* src, Color* dst, size_t count) noexcept;
+        void (*premultiply)(const uint32_t* src, uint32_t* dst, size_t count) noexcept;
+        void (*unpremultiply)(const uint32_t* src, uint32_t* dst, size_t count) noexcept;
+    };
+
+    namespace detail {
+
+        // Alpha byte 3; channel lain boleh di urutan mana pun
+        constexpr uint32_t premultiply_pixel(uint32_t pixel) noexcept {
+            uint32_t a = pixel >> 24;
+            return (pixel & 0xFF000000u) | (scale_pixel(pixel, a) & 0x00FFFFFFu);
+        }
+
+        constexpr uint32_t unpremultiply_pixel(uint32_t pixel) noexcept {
+            uint32_t a = pixel >> 24;
+            if (a == 0) return 0;
+            if (a == 255) return pixel;
+            float scale = 255.0f / static_cast<float>(a);
+            auto channel = [&](int shift) -> uint32_t {
+                uint32_t c = static_cast<uint32_t>(static_cast<float>((pixel >> shift) & 0xFF) * scale + 0.5f);
+                return (c > 255 ? 255 : c) << shift;
+            };
+            return (pixel & 0xFF000000u) | channel(16) | channel(8) | channel(0);
+        }
+
+        inline void pack_scalar(const Color* src, ColorU8* dst, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) dst[i] = src[i];
+        }
+
+        inline void unpack_scalar(const ColorU8* src, Color* dst, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) dst[i] = src[i].to_color();
+        }
+
+        inline void premultiply_scalar(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) dst[i] = premultiply_pixel(src[i]);
+        }
+
+        inline void unpremultiply_scalar(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) dst[i] = unpremultiply_pixel(src[i]);
+        }
+
+#if ZWIDGET_SIMD_X86
+        // -- SSE4.1: 4 warna per iterasi -------------------------------
+
+        // Color (r, g, b, a float) -> byte [r, g, b, a] sebagai int32
+        ZWIDGET_TARGET_SSE41 inline __m128i color_bytes_sse41(const Color& color) noexcept {
+            __m128 v = _mm_loadu_ps(reinterpret_cast<const float*>(&color));
+            v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            v = _mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f));
+            return _mm_cvttps_epi32(v);
+        }
+
+        // Lane 16-bit [r g b a r g b a] -> premultiplied; lane alpha tetap
+        ZWIDGET_TARGET_SSE41 inline __m128i premultiply_epu16_sse41(__m128i c) noexcept {
+            __m128i alpha = _mm_shuffle_epi8(c, _mm_setr_epi8(6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15));
+            // mul_div255(a, 255) == a, jadi lane alpha dikali 255
+            alpha = _mm_blend_epi16(alpha, _mm_set1_epi16(255), 0x88);
+            return div255_epu16(_mm_mullo_epi16(c, alpha));
+        }
+
+        ZWIDGET_TARGET_SSE41 void pack_sse41(const Color* src, ColorU8* dst, size_t count) noexcept {
+            static_assert(sizeof(Color) == 16 && sizeof(ColorU8) == 4);
+            __m128i to_bgra = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i c01 = _mm_packs_epi32(color_bytes_sse41(src[i]), color_bytes_sse41(src[i + 1]));
+                __m128i c23 = _mm_packs_epi32(color_bytes_sse41(src[i + 2]), color_bytes_sse41(src[i + 3]));
+                __m128i out = _mm_packus_epi16(premultiply_epu16_sse41(c01), premultiply_epu16_sse41(c23));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(out, to_bgra));
+            }
+            pack_scalar(src + i, dst + i, count - i);
+        }
+
+        ZWIDGET_TARGET_SSE41 void unpack_sse41(const ColorU8* src, Color* dst, size_t count) noexcept {
+            // [b g r a] -> int32 [r g b a]
+            __m128i to_rgba = _mm_setr_epi8(2, -1, -1, -1, 1, -1, -1, -1, 0, -1, -1, -1, 3, -1, -1, -1);
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 c255 = _mm_set1_ps(255.0f);
+            for (size_t i = 0; i < count; ++i) {
+                __m128i p = _mm_shuffle_epi8(_mm_cvtsi32_si128(static_cast<int>(src[i].value())), to_rgba);
+                __m128 c = _mm_cvtepi32_ps(p);
+                __m128 a = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+                // [1/a, 1/a, 1/a, a/255] lalu kali [r, g, b, 1]: urutan operasi sama dengan to_color
+                __m128 q = _mm_div_ps(_mm_blend_ps(one, a, 0x8), _mm_blend_ps(a, c255, 0x8));
+                __m128 out = _mm_mul_ps(q, _mm_blend_ps(c, one, 0x8));
+                out = _mm_and_ps(out, _mm_cmpneq_ps(a, _mm_setzero_ps()));
+                _mm_storeu_ps(reinterpret_cast<float*>(dst + i), out);
+            }
+        }
+
+        ZWIDGET_TARGET_SSE41 void premultiply_sse41(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            __m128i alpha_lo = _mm_setr_epi8(3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1);
+            __m128i alpha_hi = _mm_setr_epi8(11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1);
+            __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            __m128i zero = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                __m128i lo = div255_epu16(_mm_mullo_epi16(_mm_cvtepu8_epi16(s), _mm_shuffle_epi8(s, alpha_lo)));
+                __m128i hi = div255_epu16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_shuffle_epi8(s, alpha_hi)));
+                __m128i out = _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_and_si128(s, alpha_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            }
+            premultiply_scalar(src + i, dst + i, count - i);
+        }
+
+        ZWIDGET_TARGET_SSE41 void unpremultiply_sse41(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            __m128i byte_mask = _mm_set1_epi32(0xFF);
+            __m128 c255 = _mm_set1_ps(255.0f);
+            __m128 half = _mm_set1_ps(0.5f);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                __m128i a = _mm_srli_epi32(s, 24);
+                __m128 scale = _mm_div_ps(c255, _mm_cvtepi32_ps(a));
+                __m128i out = _mm_and_si128(s, alpha_mask);
+                for (int shift : {0, 8, 16}) {
+                    __m128i c = _mm_and_si128(_mm_srli_epi32(s, shift), byte_mask);
+                    __m128i v = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(c), scale), half));
+                    out = _mm_or_si128(out, _mm_slli_epi32(_mm_min_epu32(v, byte_mask), shift));
+                }
+                // a == 0 -> 0, a == 255 -> apa adanya (sama dengan scalar)
+                out = _mm_andnot_si128(_mm_cmpeq_epi32(a, _mm_setzero_si128()), out);
+                out = _mm_blendv_epi8(out, s, _mm_cmpeq_epi32(a, byte_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            }
+            unpremultiply_scalar(src + i, dst + i, count - i);
+        }
+
+        // -- AVX2: 8 warna per iterasi ---------------------------------
+
+        ZWIDGET_TARGET_AVX2 inline __m256i color_bytes_avx2(const Color* pair) noexcept {
+            __m256 v = _mm256_loadu_ps(reinterpret_cast<const float*>(pair));
+            v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+            v = _mm256_add_ps(_mm256_mul_ps(v, _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f));
+            return _mm256_cvttps_epi32(v);
+        }
+
+        ZWIDGET_TARGET_AVX2 inline __m256i premultiply_epu16_avx2(__m256i c) noexcept {
+            __m256i alpha = _mm256_shuffle_epi8(c, _mm256_setr_epi8(
+                6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+                6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15));
+            alpha = _mm256_blend_epi16(alpha, _mm256_set1_epi16(255), 0x88);
+            return div255_epu16_avx2(_mm256_mullo_epi16(c, alpha));
+        }
+
+        ZWIDGET_TARGET_AVX2 void pack_avx2(const Color* src, ColorU8* dst, size_t count) noexcept {
+            __m256i to_bgra = _mm256_setr_epi8(
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+            // packs/packus bekerja per lane 128-bit: urutan hasil 0 2 4 6 | 1 3 5 7
+            __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i lo = _mm256_packs_epi32(color_bytes_avx2(src + i), color_bytes_avx2(src + i + 2));
+                __m256i hi = _mm256_packs_epi32(color_bytes_avx2(src + i + 4), color_bytes_avx2(src + i + 6));
+                __m256i out = _mm256_packus_epi16(premultiply_epu16_avx2(lo), premultiply_epu16_avx2(hi));
+                out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(out, to_bgra), order);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+            }
+            pack_sse41(src + i, dst + i, count - i);
+        }
+
+        ZWIDGET_TARGET_AVX2 void unpack_avx2(const ColorU8* src, Color* dst, size_t count) noexcept {
+            __m256i to_rgba = _mm256_setr_epi8(
+                2, -1, -1, -1, 1, -1, -1, -1, 0, -1, -1, -1, 3, -1, -1, -1,
+                6, -1, -1, -1, 5, -1, -1, -1, 4, -1, -1, -1, 7, -1, -1, -1);
+            __m256 one = _mm256_set1_ps(1.0f);
+            __m256 c255 = _mm256_set1_ps(255.0f);
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                uint64_t pair;
+                std::memcpy(&pair, src + i, 8);
+                __m256i p = _mm256_shuffle_epi8(
+                    _mm256_set1_epi64x(static_cast<long long>(pair)), to_rgba);
+                __m256 c = _mm256_cvtepi32_ps(p);
+                __m256 a = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+                __m256 q = _mm256_div_ps(_mm256_blend_ps(one, a, 0x88), _mm256_blend_ps(a, c255, 0x88));
+                __m256 out = _mm256_mul_ps(q, _mm256_blend_ps(c, one, 0x88));
+                out = _mm256_and_ps(out, _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+                _mm256_storeu_ps(reinterpret_cast<float*>(dst + i), out);
+            }
+            unpack_sse41(src + i, dst + i, count - i);
+        }
+
+        ZWIDGET_TARGET_AVX2 void premultiply_avx2(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            __m256i alpha_lo = _mm256_setr_epi8(
+                3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1,
+                3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1);
+            __m256i alpha_hi = _mm256_setr_epi8(
+                11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1,
+                11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1);
+            __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+            __m256i zero = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                __m256i lo = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_shuffle_epi8(s, alpha_lo)));
+                __m256i hi = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_shuffle_epi8(s, alpha_hi)));
+                __m256i out = _mm256_or_si256(_mm256_packus_epi16(lo, hi), _mm256_and_si256(s, alpha_mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+            }
+            premultiply_sse41(src + i, dst + i, count - i);
+        }
+
+        ZWIDGET_TARGET_AVX2 void unpremultiply_avx2(const uint32_t* src, uint32_t* dst, size_t count) noexcept {
+            __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+            __m256i byte_mask = _mm256_set1_epi32(0xFF);
+            __m256 c255 = _mm256_set1_ps(255.0f);
+            __m256 half = _mm256_set1_ps(0.5f);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                __m256i a = _mm256_srli_epi32(s, 24);
+                __m256 scale = _mm256_div_ps(c255, _mm256_cvtepi32_ps(a));
+                __m256i out = _mm256_and_si256(s, alpha_mask);
+                for (int shift : {0, 8, 16}) {
+                    __m256i c = _mm256_and_si256(_mm256_srli_epi32(s, shift), byte_mask);
+                    __m256i v = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(c), scale), half));
+                    out = _mm256_or_si256(out, _mm256_slli_epi32(_mm256_min_epu32(v, byte_mask), shift));
+                }
+                out = _mm256_andnot_si256(_mm256_cmpeq_epi32(a, _mm256_setzero_si256()), out);
+                out = _mm256_blendv_epi8(out, s, _mm256_cmpeq_epi32(a, byte_mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+            }
+            unpremultiply_sse41(src + i, dst + i, count - i);
+        }
+#endif
+
+        constexpr ColorConvertKernels make_color_convert_kernels(SimdLevel level) noexcept {
+#if ZWIDGET_SIMD_X86
+            if (level == SimdLevel::Avx2) {
+                return ColorConvertKernels{level, &pack_avx2, &unpack_avx2, &premultiply_avx2, &unpremultiply_avx2};
+            }
+            if (level == SimdLevel::Sse41) {
+                return ColorConvertKernels{level, &pack_sse41, &unpack_sse41, &premultiply_sse41, &unpremultiply_sse41};
+            }
+#endif
+            return ColorConvertKernels{
+                SimdLevel::Scalar, &pack_scalar, &unpack_scalar, &premultiply_scalar, &unpremultiply_scalar};
+        }
+
+    } // namespace detail
+
+    // Tabel konversi untuk level tertentu (diturunkan ke kemampuan CPU)
+    inline ColorConvertKernels color_convert_kernels(SimdLevel level) noexcept {
+        return detail::make_color_convert_kernels(std::min(level, cpu_simd_level()));
+    }
+
+    // Tabel konversi terbaik untuk CPU ini
+    inline const ColorConvertKernels& color_convert_kernels() noexcept {
+        static const ColorConvertKernels kernels = detail::make_color_convert_kernels(cpu_simd_level());
+        return kernels;
+    }
+
+} // namespace zuu::widget
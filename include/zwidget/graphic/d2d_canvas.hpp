@@ -0,0 +1,844 @@
+#pragma once
+
+#include "canvas.hpp"
+#include "text_layout.hpp"
+#include <d2d1.h>
+#include <dwrite.h>
+#include <wrl/client.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#ifdef min
+	#undef min
+#endif
+#ifdef max
+	#undef max
+#endif
+
+namespace zuu::widget {
+
+    // D2DCanvas - implementasi Canvas di atas ID2D1RenderTarget
+    class D2DCanvas : public Canvas {
+    protected:
+        Microsoft::WRL::ComPtr<ID2D1RenderTarget> render_target_;
+        Microsoft::WRL::ComPtr<ID2D1SolidColorBrush> brush_;
+        std::vector<bool> clip_layers_;     // true = PushLayer, false = axis-aligned clip
+
+        // Dipakai draw_text saat format nullptr (Renderer: format default)
+        TextFormat* fallback_text_format_{nullptr};
+
+        // Hanya untuk canvas layer: target bitmap offscreen, terbuka
+        // (BeginDraw) sampai pertama kali dikomposit
+        Microsoft::WRL::ComPtr<ID2D1BitmapRenderTarget> layer_target_;
+        bool layer_open_{false};
+        const void* layer_device_{nullptr};         // Render target root (layer_device)
+
+        // Transform di bawah transform user (layer: geser bounds ke (0, 0))
+        Transform device_transform_;
+
+        // Staging scroll_rect; resource device, di-reset bersama render target
+        Microsoft::WRL::ComPtr<ID2D1Bitmap> scroll_bitmap_;
+
+        // Geometri path device-independent: dibangun sekali per path + fill rule
+        std::unordered_map<uint64_t, Microsoft::WRL::ComPtr<ID2D1PathGeometry>> path_geometries_;
+        std::vector<std::pair<StrokeStyle, Microsoft::WRL::ComPtr<ID2D1StrokeStyle>>> stroke_styles_;
+
+        static constexpr size_t max_cached_geometries = 256;
+
+        // IDWriteTextLayout device-independent: di-cache per proses, dipakai
+        // semua render target. bytes() perkiraan kasar (glyph run + cluster
+        // per karakter), DirectWrite tidak melaporkan ukuran aslinya.
+        struct DWriteLayout {
+            Microsoft::WRL::ComPtr<IDWriteTextLayout> layout;
+            size_t length{0};
+
+            size_t bytes() const noexcept { return sizeof(DWriteLayout) + length * 64; }
+        };
+
+        using DWriteLayoutCache = BasicTextLayoutCache<DWriteLayout>;
+
+        // Factory shared = instance yang sama dengan milik Renderer
+        static IDWriteFactory* dwrite_factory() {
+            static Microsoft::WRL::ComPtr<IDWriteFactory> factory = [] {
+                Microsoft::WRL::ComPtr<IDWriteFactory> created;
+                DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory),
+                    reinterpret_cast<IUnknown**>(created.GetAddressOf()));
+                return created;
+            }();
+            return factory.Get();
+        }
+
+        // IDWriteTextLayout dari DWriteLayoutCache; built = true kalau miss
+        static std::shared_ptr<const DWriteLayout> cached_layout(
+            const std::wstring& text, const basic_rect<float>& rect, TextFormat* text_format, bool& built) {
+            // Format lain dengan font sama bisa beda alignment / wrapping; yang
+            // di-hash propertinya, bukan alamat (bisa dipakai ulang setelah free)
+            detail::StateHasher format_id;
+            format_id.add(text_format_font_id(text_format))
+                .add(static_cast<uint32_t>(text_format->GetTextAlignment()))
+                .add(static_cast<uint32_t>(text_format->GetParagraphAlignment()))
+                .add(static_cast<uint32_t>(text_format->GetWordWrapping()));
+            TextLayoutKey key{format_id.value(), text_format_size(text_format), rect.w, rect.h};
+
+            return DWriteLayoutCache::global().lookup(text, key, [&]() -> std::shared_ptr<const DWriteLayout> {
+                built = true;
+                IDWriteFactory* factory = dwrite_factory();
+                if (!factory) return nullptr;
+                auto fresh = std::make_shared<DWriteLayout>();
+                fresh->length = text.size();
+                HRESULT hr = factory->CreateTextLayout(
+                    text.c_str(),
+                    static_cast<UINT32>(text.length()),
+                    text_format,
+                    std::max(rect.w, 0.0f),
+                    std::max(rect.h, 0.0f),
+                    fresh->layout.GetAddressOf()
+                );
+                if (FAILED(hr)) return nullptr;
+                return fresh;
+            });
+        }
+
+        ID2D1PathGeometry* path_geometry(const Path& path, FillRule rule) {
+            detail::StateHasher hasher;
+            hasher.add(path.hash()).add(rule);
+            uint64_t key = hasher.value();
+
+            auto it = path_geometries_.find(key);
+            if (it != path_geometries_.end()) {
+                ++frame_stats_.path_cache_hits;
+                return it->second.Get();
+            }
+            ++frame_stats_.path_cache_misses;
+
+            Microsoft::WRL::ComPtr<ID2D1Factory> factory;
+            render_target_->GetFactory(factory.GetAddressOf());
+
+            Microsoft::WRL::ComPtr<ID2D1PathGeometry> geometry;
+            Microsoft::WRL::ComPtr<ID2D1GeometrySink> sink;
+            if (FAILED(factory->CreatePathGeometry(geometry.GetAddressOf()))
+                || FAILED(geometry->Open(sink.GetAddressOf()))) {
+                return nullptr;
+            }
+
+            sink->SetFillMode(rule == FillRule::EvenOdd ? D2D1_FILL_MODE_ALTERNATE : D2D1_FILL_MODE_WINDING);
+
+            const auto& points = path.points();
+            auto point = [&](size_t i) { return D2D1::Point2F(points[i].x, points[i].y); };
+            bool open = false;
+            size_t p = 0;
+            for (Path::Verb verb : path.verbs()) {
+                switch (verb) {
+                    case Path::Verb::Move:
+                        if (open) sink->EndFigure(D2D1_FIGURE_END_OPEN);
+                        sink->BeginFigure(point(p++), D2D1_FIGURE_BEGIN_FILLED);
+                        open = true;
+                        break;
+                    case Path::Verb::Line:
+                        sink->AddLine(point(p++));
+                        break;
+                    case Path::Verb::Quad:
+                        sink->AddQuadraticBezier(D2D1::QuadraticBezierSegment(point(p), point(p + 1)));
+                        p += 2;
+                        break;
+                    case Path::Verb::Cubic:
+                        sink->AddBezier(D2D1::BezierSegment(point(p), point(p + 1), point(p + 2)));
+                        p += 3;
+                        break;
+                    case Path::Verb::Close:
+                        if (open) sink->EndFigure(D2D1_FIGURE_END_CLOSED);
+                        open = false;
+                        break;
+                }
+            }
+            if (open) sink->EndFigure(D2D1_FIGURE_END_OPEN);
+            if (FAILED(sink->Close())) return nullptr;
+
+            if (path_geometries_.size() >= max_cached_geometries) {
+                path_geometries_.clear();
+            }
+            return path_geometries_.emplace(key, std::move(geometry)).first->second.Get();
+        }
+
+        ID2D1StrokeStyle* stroke_style(const StrokeStyle& style) {
+            for (const auto& [key, value] : stroke_styles_) {
+                if (key == style) return value.Get();
+            }
+
+            auto cap = [](LineCap c) {
+                switch (c) {
+                    case LineCap::Square: return D2D1_CAP_STYLE_SQUARE;
+                    case LineCap::Round: return D2D1_CAP_STYLE_ROUND;
+                    default: return D2D1_CAP_STYLE_FLAT;
+                }
+            };
+            D2D1_LINE_JOIN join = style.join == LineJoin::Round ? D2D1_LINE_JOIN_ROUND
+                : style.join == LineJoin::Bevel ? D2D1_LINE_JOIN_BEVEL
+                : D2D1_LINE_JOIN_MITER_OR_BEVEL;
+
+            Microsoft::WRL::ComPtr<ID2D1Factory> factory;
+            render_target_->GetFactory(factory.GetAddressOf());
+
+            Microsoft::WRL::ComPtr<ID2D1StrokeStyle> result;
+            HRESULT hr = factory->CreateStrokeStyle(
+                D2D1::StrokeStyleProperties(cap(style.cap), cap(style.cap), cap(style.cap), join, style.miter_limit),
+                nullptr, 0, result.GetAddressOf()
+            );
+            if (FAILED(hr)) return nullptr;
+
+            stroke_styles_.emplace_back(style, result);
+            return result.Get();
+        }
+
+        // Jalankan draw dengan transform tambahan di atas transform target
+        template <typename Fn>
+        void with_transform(const Transform& transform, Fn&& fn) {
+            if (transform.is_identity()) {
+                fn();
+                return;
+            }
+
+            D2D1_MATRIX_3X2_F previous;
+            render_target_->GetTransform(&previous);
+            render_target_->SetTransform(
+                D2D1::Matrix3x2F(transform.m11, transform.m12, transform.m21, transform.m22, transform.dx, transform.dy)
+                * D2D1::Matrix3x2F::ReinterpretBaseType(&previous)
+            );
+            fn();
+            render_target_->SetTransform(previous);
+        }
+
+        // Primitive (bounds koordinat user) di luar clip efektif: lewati
+        // SetColor dan submission ke D2D
+        bool culled(const basic_rect<float>& bounds) noexcept {
+            if (clip_bounds_.empty()) return false;
+            return cull(transform_.is_identity() ? bounds : map_rect(bounds));
+        }
+
+        static basic_rect<float> rect_bounds(const basic_rect<float>& rect, float width) noexcept {
+            return stroke_bounds(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, width);
+        }
+
+    public:
+        D2DCanvas() = default;
+        ~D2DCanvas() override = default;
+
+        D2DCanvas(const D2DCanvas&) = delete;
+        D2DCanvas& operator=(const D2DCanvas&) = delete;
+        D2DCanvas(D2DCanvas&&) = default;
+        D2DCanvas& operator=(D2DCanvas&&) = default;
+
+        // Basic drawing operations
+        void clear(ColorU8 color) override {
+            if (render_target_) {
+                render_target_->Clear(color.to_d2d());
+            }
+        }
+
+        void draw_line(
+            const basic_point<float>& start,
+            const basic_point<float>& end,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!render_target_ || !brush_) return;
+            if (culled(stroke_bounds(start.x, start.y, end.x, end.y, width))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->DrawLine(
+                D2D1::Point2F(start.x, start.y),
+                D2D1::Point2F(end.x, end.y),
+                brush_.Get(),
+                width
+            );
+        }
+
+        void draw_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!render_target_ || !brush_ || culled(rect_bounds(rect, width))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->DrawRectangle(
+                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                brush_.Get(),
+                width
+            );
+        }
+
+        void fill_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color
+        ) override {
+            if (!render_target_ || !brush_ || culled(rect_bounds(rect, 0.0f))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->FillRectangle(
+                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                brush_.Get()
+            );
+        }
+
+        // Layout DirectWrite dari cache: shaping + line breaking hanya saat
+        // teks, format atau box berubah. Tinggi box ikut key karena
+        // paragraph alignment format memakainya.
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (!text_format) text_format = fallback_text_format_;
+            if (!render_target_ || !brush_ || !text_format) return;
+            if (culled(text_bounds(text, rect, text_format_size(text_format)))) return;
+
+            bool built = false;
+            auto cached = cached_layout(text, rect, text_format, built);
+            ++(built ? frame_stats_.text_layout_misses : frame_stats_.text_layout_hits);
+
+            brush_->SetColor(color.to_d2d());
+            if (!cached) {
+                render_target_->DrawText(
+                    text.c_str(),
+                    static_cast<UINT32>(text.length()),
+                    text_format,
+                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                    brush_.Get()
+                );
+                return;
+            }
+            render_target_->DrawTextLayout(D2D1::Point2F(rect.x, rect.y), cached->layout.Get(), brush_.Get());
+        }
+
+        // Overhang metrics = jarak tinta ke tepi layout box (negatif kalau
+        // di dalam), +1px untuk antialiasing
+        basic_rect<float> cached_text_bounds(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (!text_format) text_format = fallback_text_format_;
+            float size = text_format_size(text_format);
+            if (!text_format || text.empty()) return text_bounds(text, rect, size);
+
+            bool built = false;
+            auto cached = cached_layout(text, rect, text_format, built);
+            DWRITE_OVERHANG_METRICS overhang{};
+            if (!cached || FAILED(cached->layout->GetOverhangMetrics(&overhang))) return text_bounds(text, rect, size);
+
+            float w = std::max(rect.w, 0.0f), h = std::max(rect.h, 0.0f);
+            float x0 = rect.x - overhang.left - 1.0f, y0 = rect.y - overhang.top - 1.0f;
+            float x1 = rect.x + w + overhang.right + 1.0f, y1 = rect.y + h + overhang.bottom + 1.0f;
+            return basic_rect<float>(x0, y0, std::max(x1 - x0, 0.0f), std::max(y1 - y0, 0.0f));
+        }
+
+        // Batch: brush di-set sekali untuk seluruh span
+        void fill_rects(std::span<const basic_rect<float>> rects, ColorU8 color) override {
+            if (!render_target_ || !brush_ || rects.empty()) return;
+
+            bool brush_set = false;
+            for (const auto& rect : rects) {
+                if (culled(rect_bounds(rect, 0.0f))) continue;
+                if (!brush_set) {
+                    brush_->SetColor(color.to_d2d());
+                    brush_set = true;
+                }
+                render_target_->FillRectangle(
+                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                    brush_.Get()
+                );
+            }
+        }
+
+        void draw_rects(std::span<const basic_rect<float>> rects, ColorU8 color, float width = 1.0f) override {
+            if (!render_target_ || !brush_ || rects.empty()) return;
+
+            bool brush_set = false;
+            for (const auto& rect : rects) {
+                if (culled(rect_bounds(rect, width))) continue;
+                if (!brush_set) {
+                    brush_->SetColor(color.to_d2d());
+                    brush_set = true;
+                }
+                render_target_->DrawRectangle(
+                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                    brush_.Get(),
+                    width
+                );
+            }
+        }
+
+        // Batch multi-warna: SetColor hanya saat warna berganti (di antara
+        // item yang lolos cull)
+        void fill_rects(std::span<const RectColor> rects) override {
+            if (!render_target_ || !brush_ || rects.empty()) return;
+
+            const ColorU8* current = nullptr;
+            for (const auto& r : rects) {
+                if (culled(rect_bounds(r.rect, 0.0f))) continue;
+                if (!current || r.color != *current) {
+                    brush_->SetColor(r.color.to_d2d());
+                    current = &r.color;
+                }
+                render_target_->FillRectangle(
+                    D2D1::RectF(r.rect.x, r.rect.y, r.rect.x + r.rect.w, r.rect.y + r.rect.h),
+                    brush_.Get()
+                );
+            }
+        }
+
+        void draw_lines(std::span<const LineSeg> lines) override {
+            if (!render_target_ || !brush_ || lines.empty()) return;
+
+            const ColorU8* current = nullptr;
+            for (const auto& l : lines) {
+                if (culled(stroke_bounds(l.start.x, l.start.y, l.end.x, l.end.y, l.width))) continue;
+                if (!current || l.color != *current) {
+                    brush_->SetColor(l.color.to_d2d());
+                    current = &l.color;
+                }
+                render_target_->DrawLine(
+                    D2D1::Point2F(l.start.x, l.start.y),
+                    D2D1::Point2F(l.end.x, l.end.y),
+                    brush_.Get(),
+                    l.width
+                );
+            }
+        }
+
+        void fill_rounded_rects(std::span<const RoundedRectColor> rects) override {
+            if (!render_target_ || !brush_ || rects.empty()) return;
+
+            const ColorU8* current = nullptr;
+            for (const auto& r : rects) {
+                if (culled(rect_bounds(r.rect, 0.0f))) continue;
+                if (!current || r.color != *current) {
+                    brush_->SetColor(r.color.to_d2d());
+                    current = &r.color;
+                }
+                render_target_->FillRoundedRectangle(
+                    D2D1::RoundedRect(
+                        D2D1::RectF(r.rect.x, r.rect.y, r.rect.x + r.rect.w, r.rect.y + r.rect.h),
+                        r.radius_x,
+                        r.radius_y
+                    ),
+                    brush_.Get()
+                );
+            }
+        }
+
+        void draw_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!render_target_ || !brush_ || culled(rect_bounds(rect, width))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->DrawRoundedRectangle(
+                D2D1::RoundedRect(
+                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                    radius_x,
+                    radius_y
+                ),
+                brush_.Get(),
+                width
+            );
+        }
+
+        void fill_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            if (!render_target_ || !brush_ || culled(rect_bounds(rect, 0.0f))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->FillRoundedRectangle(
+                D2D1::RoundedRect(
+                    D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                    radius_x,
+                    radius_y
+                ),
+                brush_.Get()
+            );
+        }
+
+        void draw_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            if (!render_target_ || !brush_) return;
+            if (culled(stroke_bounds(center.x - radius_x, center.y - radius_y,
+                                     center.x + radius_x, center.y + radius_y, width))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->DrawEllipse(
+                D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius_x, radius_y),
+                brush_.Get(),
+                width
+            );
+        }
+
+        void fill_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            if (!render_target_ || !brush_) return;
+            if (culled(stroke_bounds(center.x - radius_x, center.y - radius_y,
+                                     center.x + radius_x, center.y + radius_y, 0.0f))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->FillEllipse(
+                D2D1::Ellipse(D2D1::Point2F(center.x, center.y), radius_x, radius_y),
+                brush_.Get()
+            );
+        }
+
+        void fill_path(
+            const Path& path,
+            ColorU8 color,
+            FillRule rule = FillRule::NonZero,
+            const Transform& transform = Transform::identity()
+        ) override {
+            if (!render_target_ || !brush_ || path.empty()) return;
+            if (culled(path_bounds(path, transform, nullptr))) return;
+
+            ID2D1PathGeometry* geometry = path_geometry(path, rule);
+            if (!geometry) return;
+
+            brush_->SetColor(color.to_d2d());
+            with_transform(transform, [&] {
+                render_target_->FillGeometry(geometry, brush_.Get());
+            });
+        }
+
+        void stroke_path(
+            const Path& path,
+            ColorU8 color,
+            const StrokeStyle& style = StrokeStyle{},
+            const Transform& transform = Transform::identity()
+        ) override {
+            if (!render_target_ || !brush_ || path.empty()) return;
+            if (culled(path_bounds(path, transform, &style))) return;
+
+            ID2D1PathGeometry* geometry = path_geometry(path, FillRule::NonZero);
+            if (!geometry) return;
+
+            brush_->SetColor(color.to_d2d());
+            ID2D1StrokeStyle* stroke = stroke_style(style);
+            with_transform(transform, [&] {
+                render_target_->DrawGeometry(geometry, brush_.Get(), style.width, stroke);
+            });
+        }
+
+        // Text rendering (simplified - can be extended)
+        void draw_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (!text_format) text_format = fallback_text_format_;
+            if (!render_target_ || !brush_ || !text_format) return;
+            if (culled(text_bounds(text, rect, text_format_size(text_format)))) return;
+
+            brush_->SetColor(color.to_d2d());
+            render_target_->DrawText(
+                text.c_str(),
+                static_cast<UINT32>(text.length()),
+                text_format,
+                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                brush_.Get()
+            );
+        }
+
+        // Layout DirectWrite tanpa wrap; advance per cluster dari
+        // GetClusterMetrics (dipasang di unit pertama cluster, sisanya 0)
+        TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) override {
+            if (!text_format) text_format = fallback_text_format_;
+            IDWriteFactory* factory = dwrite_factory();
+            if (!text_format || !factory) return Canvas::measure_text(text, text_format, advances);
+
+            Microsoft::WRL::ComPtr<IDWriteTextLayout> layout;
+            HRESULT hr = factory->CreateTextLayout(
+                text.c_str(), static_cast<UINT32>(text.length()), text_format,
+                1.0e6f, 1.0e6f, layout.GetAddressOf());
+            if (FAILED(hr)) return Canvas::measure_text(text, text_format, advances);
+            layout->SetWordWrapping(DWRITE_WORD_WRAPPING_NO_WRAP);
+
+            TextMetrics result;
+            DWRITE_TEXT_METRICS metrics{};
+            if (SUCCEEDED(layout->GetMetrics(&metrics))) {
+                result.width = metrics.widthIncludingTrailingWhitespace;
+            }
+            // Baris pertama; teks dengan '\n' punya lebih dari satu
+            UINT32 line_count = 0;
+            layout->GetLineMetrics(nullptr, 0, &line_count);
+            std::vector<DWRITE_LINE_METRICS> lines(line_count);
+            if (line_count > 0 && SUCCEEDED(layout->GetLineMetrics(lines.data(), line_count, &line_count))) {
+                result.ascent = lines[0].baseline;
+                result.descent = lines[0].height - lines[0].baseline;
+                result.line_height = lines[0].height;
+            }
+
+            if (advances) {
+                advances->assign(text.size(), 0.0f);
+                UINT32 count = 0;
+                layout->GetClusterMetrics(nullptr, 0, &count);
+                std::vector<DWRITE_CLUSTER_METRICS> clusters(count);
+                if (count > 0 && SUCCEEDED(layout->GetClusterMetrics(clusters.data(), count, &count))) {
+                    size_t at = 0;
+                    for (const auto& cluster : clusters) {
+                        if (at < advances->size()) (*advances)[at] = cluster.width;
+                        at += cluster.length;
+                    }
+                }
+            }
+            return result;
+        }
+
+        // Layer = compatible bitmap render target; transform menggeser
+        // bounds ke (0, 0) jadi subtree digambar dengan koordinat absolutnya
+        std::unique_ptr<Canvas> create_layer(const basic_rect<int>& bounds) override {
+            if (!render_target_ || bounds.w <= 0 || bounds.h <= 0) return nullptr;
+
+            Microsoft::WRL::ComPtr<ID2D1BitmapRenderTarget> target;
+            HRESULT hr = render_target_->CreateCompatibleRenderTarget(
+                D2D1::SizeF(static_cast<float>(bounds.w), static_cast<float>(bounds.h)),
+                target.GetAddressOf()
+            );
+            if (FAILED(hr)) return nullptr;
+
+            auto layer = std::make_unique<D2DCanvas>();
+            hr = target->CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::Black), layer->brush_.GetAddressOf());
+            if (FAILED(hr)) return nullptr;
+
+            layer->render_target_ = target;
+            layer->layer_target_ = target;
+            layer->layer_device_ = layer_device();
+            layer->fallback_text_format_ = fallback_text_format_;
+            layer->device_transform_ = Transform::translation(
+                static_cast<float>(-bounds.x), static_cast<float>(-bounds.y));
+
+            target->BeginDraw();
+            target->Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+            target->SetTransform(D2D1::Matrix3x2F::Translation(
+                static_cast<float>(-bounds.x), static_cast<float>(-bounds.y)));
+            layer->layer_open_ = true;
+            return layer;
+        }
+
+        // Layer (termasuk layer bersarang) terikat render target root
+        const void* layer_device() const noexcept override {
+            return layer_device_ ? layer_device_ : render_target_.Get();
+        }
+
+        bool draw_layer(Canvas& layer, const basic_rect<int>& bounds) override {
+            auto* source = dynamic_cast<D2DCanvas*>(&layer);
+            if (!render_target_ || !source || !source->layer_target_) return false;
+
+            if (source->layer_open_) {
+                source->layer_open_ = false;
+                if (FAILED(source->layer_target_->EndDraw())) return false;
+            }
+
+            Microsoft::WRL::ComPtr<ID2D1Bitmap> bitmap;
+            if (FAILED(source->layer_target_->GetBitmap(bitmap.GetAddressOf()))) return false;
+
+            render_target_->DrawBitmap(
+                bitmap.Get(),
+                D2D1::RectF(
+                    static_cast<float>(bounds.x), static_cast<float>(bounds.y),
+                    static_cast<float>(bounds.x + bounds.w), static_cast<float>(bounds.y + bounds.h)
+                ),
+                1.0f,
+                D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR
+            );
+            return true;
+        }
+
+        // Blit: area sumber disalin ke bitmap staging lalu digambar di posisi
+        // baru. CopyFromRenderTarget menolak target yang masih punya clip /
+        // layer, jadi dipanggil di awal frame sebelum clip damage di-push.
+        // Target window opaque, jadi source-over DrawBitmap = salinan persis.
+        bool scroll_rect(const basic_rect<int>& area, int dx, int dy) override {
+            if (!render_target_ || !clip_layers_.empty()) return false;
+
+            int x0 = std::max(area.x, area.x - dx), y0 = std::max(area.y, area.y - dy);
+            int x1 = std::min(area.x + area.w, area.x + area.w - dx);
+            int y1 = std::min(area.y + area.h, area.y + area.h - dy);
+            if (x1 <= x0 || y1 <= y0 || (dx == 0 && dy == 0)) return true;
+
+            auto w = static_cast<UINT32>(x1 - x0), h = static_cast<UINT32>(y1 - y0);
+            if (!scroll_bitmap_ || scroll_bitmap_->GetPixelSize().width < w || scroll_bitmap_->GetPixelSize().height < h) {
+                scroll_bitmap_.Reset();
+                D2D1_SIZE_U current = render_target_->GetPixelSize();
+                HRESULT hr = render_target_->CreateBitmap(
+                    D2D1::SizeU(std::max(w, current.width), std::max(h, current.height)),
+                    D2D1::BitmapProperties(render_target_->GetPixelFormat()),
+                    scroll_bitmap_.GetAddressOf()
+                );
+                if (FAILED(hr)) return false;
+            }
+
+            // Koordinat piksel target (layer: relatif ke bounds-nya)
+            int ox = static_cast<int>(device_transform_.dx), oy = static_cast<int>(device_transform_.dy);
+            D2D1_POINT_2U origin = D2D1::Point2U(0, 0);
+            D2D1_RECT_U source = D2D1::RectU(
+                static_cast<UINT32>(x0 + ox), static_cast<UINT32>(y0 + oy),
+                static_cast<UINT32>(x1 + ox), static_cast<UINT32>(y1 + oy));
+            if (FAILED(scroll_bitmap_->CopyFromRenderTarget(&origin, render_target_.Get(), &source))) return false;
+
+            D2D1_MATRIX_3X2_F previous;
+            render_target_->GetTransform(&previous);
+            render_target_->SetTransform(D2D1::Matrix3x2F::Translation(
+                device_transform_.dx, device_transform_.dy));
+            render_target_->DrawBitmap(
+                scroll_bitmap_.Get(),
+                D2D1::RectF(
+                    static_cast<float>(x0 + dx), static_cast<float>(y0 + dy),
+                    static_cast<float>(x1 + dx), static_cast<float>(y1 + dy)),
+                1.0f,
+                D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+                D2D1::RectF(0.0f, 0.0f, static_cast<float>(w), static_cast<float>(h))
+            );
+            render_target_->SetTransform(previous);
+            return true;
+        }
+
+        // Transform user langsung jadi transform render target; D2D juga
+        // menerapkannya ke clip axis-aligned (bounding box) dan layer
+        void set_transform(const Transform& transform) override {
+            Canvas::set_transform(transform);
+            if (!render_target_) return;
+
+            Transform m = transform * device_transform_;
+            render_target_->SetTransform(D2D1::Matrix3x2F(m.m11, m.m12, m.m21, m.m22, m.dx, m.dy));
+        }
+
+        size_t clip_depth() const noexcept override {
+            return clip_layers_.size();
+        }
+
+        // Clipping
+        void push_clip(const basic_rect<float>& rect) override {
+            if (!render_target_) return;
+
+            render_target_->PushAxisAlignedClip(
+                D2D1::RectF(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h),
+                D2D1_ANTIALIAS_MODE_PER_PRIMITIVE
+            );
+            clip_layers_.push_back(false);
+            track_clip(map_rect(rect));
+        }
+
+        // Region non-rect jadi geometric mask (geometry group dari box-nya)
+        // pada satu layer, supaya semua draw call frame ini di-clip sekali
+        void push_clip_region(const Region& region) override {
+            if (!render_target_) return;
+
+            basic_rect<int> b = region.bounds();
+            basic_rect<float> bounds(
+                static_cast<float>(b.x),
+                static_cast<float>(b.y),
+                static_cast<float>(b.w),
+                static_cast<float>(b.h)
+            );
+            if (region.is_rect()) {
+                push_clip(bounds);
+                return;
+            }
+
+            Microsoft::WRL::ComPtr<ID2D1Factory> factory;
+            render_target_->GetFactory(factory.GetAddressOf());
+
+            std::vector<Microsoft::WRL::ComPtr<ID2D1RectangleGeometry>> geometries;
+            std::vector<ID2D1Geometry*> raw;
+            geometries.reserve(region.box_count());
+            raw.reserve(region.box_count());
+
+            for (const auto& box : region.boxes()) {
+                Microsoft::WRL::ComPtr<ID2D1RectangleGeometry> geometry;
+                HRESULT hr = factory->CreateRectangleGeometry(
+                    D2D1::RectF(
+                        static_cast<float>(box.x1), static_cast<float>(box.y1),
+                        static_cast<float>(box.x2), static_cast<float>(box.y2)
+                    ),
+                    geometry.GetAddressOf()
+                );
+                if (FAILED(hr)) {
+                    push_clip(bounds);
+                    return;
+                }
+                raw.push_back(geometry.Get());
+                geometries.push_back(std::move(geometry));
+            }
+
+            Microsoft::WRL::ComPtr<ID2D1GeometryGroup> group;
+            HRESULT hr = factory->CreateGeometryGroup(
+                D2D1_FILL_MODE_WINDING,
+                raw.data(),
+                static_cast<UINT32>(raw.size()),
+                group.GetAddressOf()
+            );
+            if (FAILED(hr)) {
+                push_clip(bounds);
+                return;
+            }
+
+            render_target_->PushLayer(
+                D2D1::LayerParameters(
+                    D2D1::InfiniteRect(),
+                    group.Get(),
+                    D2D1_ANTIALIAS_MODE_ALIASED
+                ),
+                nullptr
+            );
+            clip_layers_.push_back(true);
+            track_clip(map_rect(bounds));
+        }
+
+        void pop_clip() override {
+            if (!render_target_ || clip_layers_.empty()) return;
+
+            bool layer = clip_layers_.back();
+            clip_layers_.pop_back();
+            untrack_clip();
+            if (layer) {
+                render_target_->PopLayer();
+            } else {
+                render_target_->PopAxisAlignedClip();
+            }
+        }
+
+        // Getters
+        ID2D1RenderTarget* get_render_target() const noexcept {
+            return render_target_.Get();
+        }
+
+        ID2D1SolidColorBrush* get_brush() const noexcept {
+            return brush_.Get();
+        }
+
+        bool is_valid() const noexcept override {
+            return render_target_ != nullptr && brush_ != nullptr;
+        }
+    };
+
+} // namespace zuu::widget
\ No newline at end of file
@@ -0,0 +1,425 @@
+#pragma once
+
+#include "region.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Dirty region tracker untuk partial redraw.
+    //
+    // Damage disimpan sebagai Region yang eksak. Saat renderer meminta daftar
+    // rect, region di-coalesce dengan model biaya: setiap rect terpisah
+    // dihargai region_cost piksel (overhead satu pass clip + traversal), jadi
+    // dua rect digabung ke bounding box-nya hanya kalau piksel ekstra yang ikut
+    // dicat lebih murah dari overhead satu rect. Full redraw hanya dipilih
+    // kalau memang lebih murah dari total biaya rect-rect tersebut.
+    // Jumlah rect tidak dibatasi kecuali backend memintanya (set_max_regions).
+    //
+    // Region eksak + coalesce tumbuh superlinear terhadap jumlah rect, jadi
+    // di atas max_exact_rects damage langsung di-bucket ke grid (lihat
+    // bucket): jauh lebih murah, dengan rect lebih banyak dan get_region()
+    // yang berupa superset damage.
+    class DirtyRegionTracker {
+    private:
+        using Box = Region::Box;
+
+        static constexpr size_t max_exact_rects = 64;
+
+        basic_rect<int> bounds_{0, 0, 0, 0};
+        int64_t region_cost_{32 * 32};
+        size_t max_regions_{SIZE_MAX};              // SIZE_MAX = tanpa batas
+        bool is_full_dirty_{false};
+
+        // mark_dirty hanya menumpuk rect; union ke Region dilakukan sekaligus
+        // di resolve() yang dihitung lazy dan di-reset tiap mark_dirty
+        mutable std::vector<basic_rect<int>> pending_;
+        mutable Region damage_;
+        mutable Region full_region_;
+        mutable std::vector<basic_rect<int>> coalesced_;
+        mutable Region paint_region_;
+        mutable bool resolved_{true};
+        mutable bool escalated_full_{false};
+
+        bool has_bounds() const noexcept {
+            return bounds_.w > 0 && bounds_.h > 0;
+        }
+
+        static int64_t waste_of(const Box& a, const Box& b) noexcept {
+            Box bb{
+                std::min(a.x1, b.x1), std::min(a.y1, b.y1),
+                std::max(a.x2, b.x2), std::max(a.y2, b.y2)
+            };
+            int ox = std::min(a.x2, b.x2) - std::max(a.x1, b.x1);
+            int oy = std::min(a.y2, b.y2) - std::max(a.y1, b.y1);
+            int64_t overlap = (ox > 0 && oy > 0) ? static_cast<int64_t>(ox) * oy : 0;
+            return bb.area() - (a.area() + b.area() - overlap);
+        }
+
+        // Satu sweep atas box terurut y1: tiap box digabung ke kandidat aktif
+        // dengan waste terkecil (kalau <= cost), selain itu jadi kandidat baru.
+        // Gap vertikal * lebar kandidat adalah batas bawah waste, jadi kandidat
+        // yang sudah terlalu jauh di atas di-retire permanen. Diulang sampai
+        // stabil karena hasil merge bisa membuka merge baru.
+        static void coalesce(std::vector<Box>& boxes, int64_t cost) {
+            std::vector<Box> merged;
+            std::vector<size_t> active;
+
+            while (true) {
+                std::sort(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) {
+                    return a.y1 != b.y1 ? a.y1 < b.y1 : a.x1 < b.x1;
+                });
+
+                merged.clear();
+                active.clear();
+
+                for (const auto& box : boxes) {
+                    size_t best = SIZE_MAX;
+                    int64_t best_waste = cost;
+
+                    size_t keep = 0;
+                    for (size_t index : active) {
+                        const Box& m = merged[index];
+                        int64_t gap = box.y1 - m.y2;
+                        if (gap > 0 && gap * (m.x2 - m.x1) > cost) {
+                            continue;  // retire
+                        }
+                        active[keep++] = index;
+
+                        int64_t waste = waste_of(m, box);
+                        if (waste <= best_waste) {
+                            best_waste = waste;
+                            best = index;
+                        }
+                    }
+                    active.resize(keep);
+
+                    if (best != SIZE_MAX) {
+                        Box& m = merged[best];
+                        m = {
+                            std::min(m.x1, box.x1), m.y1,
+                            std::max(m.x2, box.x2), std::max(m.y2, box.y2)
+                        };
+                    } else {
+                        active.push_back(merged.size());
+                        merged.push_back(box);
+                    }
+                }
+
+                bool stable = merged.size() == boxes.size();
+                boxes.swap(merged);
+                if (stable) break;
+            }
+        }
+
+        // Paksa jumlah box <= max_count dengan menggabung pasangan termurah
+        // dulu (agglomerative). Kalau box masih sangat banyak, harga per box
+        // dinaikkan dulu supaya jumlah pasangan yang dievaluasi tetap kecil.
+        static void reduce(std::vector<Box>& boxes, size_t max_count, int64_t cost) {
+            while (boxes.size() > max_count * 2) {
+                cost *= 2;
+                coalesce(boxes, cost);
+            }
+            if (boxes.size() <= max_count) return;
+
+            struct Pair {
+                int64_t waste;
+                size_t a, b;
+                bool operator>(const Pair& o) const noexcept { return waste > o.waste; }
+            };
+
+            std::vector<bool> alive(boxes.size(), true);
+            std::priority_queue<Pair, std::vector<Pair>, std::greater<>> heap;
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                for (size_t j = i + 1; j < boxes.size(); ++j) {
+                    heap.push({waste_of(boxes[i], boxes[j]), i, j});
+                }
+            }
+
+            size_t count = boxes.size();
+            while (count > max_count && !heap.empty()) {
+                Pair p = heap.top();
+                heap.pop();
+                if (!alive[p.a] || !alive[p.b]) continue;
+
+                Box& a = boxes[p.a];
+                const Box& b = boxes[p.b];
+                a = {
+                    std::min(a.x1, b.x1), std::min(a.y1, b.y1),
+                    std::max(a.x2, b.x2), std::max(a.y2, b.y2)
+                };
+                alive[p.b] = false;
+                --count;
+
+                // Pasangan lama milik p.a sekarang basi; ganti index baru
+                boxes.push_back(a);
+                alive[p.a] = false;
+                alive.push_back(true);
+                size_t merged = boxes.size() - 1;
+                for (size_t k = 0; k < merged; ++k) {
+                    if (alive[k]) {
+                        heap.push({waste_of(boxes[k], boxes[merged]), k, merged});
+                    }
+                }
+            }
+
+            size_t out = 0;
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                if (alive[i]) boxes[out++] = boxes[i];
+            }
+            boxes.resize(out);
+        }
+
+        // Bounding box per sel grid bersisi ~sqrt(cost): tiap rect masuk sel
+        // yang memuat titik tengahnya, jadi waste per sel kira-kira setara
+        // biaya satu rect. O(n); hasil boleh saling overlap.
+        static void bucket(std::vector<Box>& boxes, int64_t cost) {
+            Box ext = boxes.front();
+            for (const auto& box : boxes) {
+                ext = {
+                    std::min(ext.x1, box.x1), std::min(ext.y1, box.y1),
+                    std::max(ext.x2, box.x2), std::max(ext.y2, box.y2)
+                };
+            }
+
+            int64_t cell = 8;
+            while (cell * cell < cost) cell *= 2;
+            int64_t cols = (ext.x2 - ext.x1 + cell - 1) / cell;
+            int64_t rows = (ext.y2 - ext.y1 + cell - 1) / cell;
+            while (cols * rows > static_cast<int64_t>(boxes.size()) * 16) {
+                cell *= 2;
+                cols = (cols + 1) / 2;
+                rows = (rows + 1) / 2;
+            }
+
+            constexpr Box empty{INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN};
+            std::vector<Box> cells(static_cast<size_t>(cols * rows), empty);
+            for (const auto& box : boxes) {
+                int64_t cx = std::min<int64_t>(((box.x1 + box.x2) / 2 - ext.x1) / cell, cols - 1);
+                int64_t cy = std::min<int64_t>(((box.y1 + box.y2) / 2 - ext.y1) / cell, rows - 1);
+                Box& c = cells[static_cast<size_t>(cy * cols + cx)];
+                c = {
+                    std::min(c.x1, box.x1), std::min(c.y1, box.y1),
+                    std::max(c.x2, box.x2), std::max(c.y2, box.y2)
+                };
+            }
+
+            boxes.clear();
+            for (const auto& c : cells) {
+                if (c.x1 < c.x2) boxes.push_back(c);
+            }
+        }
+
+        // Jalur murah untuk damage yang sangat terfragmentasi: pending + damage
+        // lama di-clip ke bounds lalu di-bucket, tanpa membangun Region eksak
+        bool bucket_pending(std::vector<Box>& boxes) const {
+            if (pending_.size() + damage_.boxes().size() <= max_exact_rects) return false;
+
+            boxes = damage_.boxes();
+            for (const auto& rect : pending_) {
+                Box box{rect.x, rect.y, rect.x + rect.w, rect.y + rect.h};
+                if (has_bounds()) {
+                    box = {
+                        std::max(box.x1, bounds_.x), std::max(box.y1, bounds_.y),
+                        std::min(box.x2, bounds_.x + bounds_.w), std::min(box.y2, bounds_.y + bounds_.h)
+                    };
+                }
+                if (box.x1 < box.x2 && box.y1 < box.y2) boxes.push_back(box);
+            }
+            pending_.clear();
+            damage_.clear();
+            if (!boxes.empty()) bucket(boxes, region_cost_);
+            return true;
+        }
+
+        void merge_pending() const {
+            if (pending_.empty()) return;
+
+            std::vector<basic_rect<int>> rects = pending_;
+            if (!damage_.is_empty()) {
+                for (const auto& box : damage_.boxes()) {
+                    rects.push_back(box.to_rect());
+                }
+            }
+            damage_ = Region::from_rects(rects);
+            if (has_bounds()) {
+                damage_.intersect(bounds_);
+            }
+            pending_.clear();
+        }
+
+        void resolve() const {
+            if (resolved_) return;
+            resolved_ = true;
+            escalated_full_ = false;
+            coalesced_.clear();
+            paint_region_.clear();
+
+            if (is_full_dirty_) return;
+
+            std::vector<Box> boxes;
+            bool bucketed = bucket_pending(boxes);
+            if (!bucketed) {
+                merge_pending();
+                boxes = damage_.boxes();
+                coalesce(boxes, region_cost_);
+            }
+            if (boxes.empty()) return;
+
+            if (boxes.size() > max_regions_) {
+                reduce(boxes, max_regions_, region_cost_);
+            }
+
+            int64_t painted = 0;
+            for (const auto& box : boxes) {
+                painted += box.area();
+            }
+
+            if (has_bounds()) {
+                int64_t full = static_cast<int64_t>(bounds_.w) * bounds_.h;
+                int64_t split_cost = painted + static_cast<int64_t>(boxes.size()) * region_cost_;
+                if (split_cost >= full + region_cost_) {
+                    escalated_full_ = true;
+                    if (bucketed) damage_ = Region(bounds_);
+                    return;
+                }
+            }
+
+            coalesced_.reserve(boxes.size());
+            for (const auto& box : boxes) {
+                coalesced_.push_back(box.to_rect());
+            }
+            paint_region_ = Region::from_rects(coalesced_);
+            if (bucketed) damage_ = paint_region_;
+        }
+
+    public:
+        // Ukuran surface: damage di-clip ke sini dan dipakai untuk menilai
+        // apakah full redraw lebih murah
+        void set_bounds(const basic_rect<int>& bounds) {
+            bounds_ = bounds;
+            resolved_ = false;
+        }
+
+        // Overhead satu rect dalam satuan piksel
+        void set_region_cost(int64_t pixels) noexcept {
+            region_cost_ = std::max<int64_t>(0, pixels);
+            resolved_ = false;
+        }
+
+        // Batas keras jumlah rect untuk backend yang biaya clip-nya naik
+        // per rect (geometry group D2D); default tanpa batas
+        void set_max_regions(size_t count) noexcept {
+            max_regions_ = std::max<size_t>(1, count);
+            resolved_ = false;
+        }
+
+        void mark_dirty(const basic_rect<int>& region) {
+            if (is_full_dirty_) return;
+            if (region.w <= 0 || region.h <= 0) return;
+
+            pending_.push_back(region);
+            resolved_ = false;
+        }
+
+        void mark_dirty(const Region& region) {
+            if (is_full_dirty_) return;
+
+            for (const auto& box : region.boxes()) {
+                pending_.push_back(box.to_rect());
+            }
+            resolved_ = false;
+        }
+
+        // Konten area sudah digeser (dx, dy) dengan blit. Damage yang belum
+        // dicat di area ikut bergeser (piksel basinya ikut pindah), lalu
+        // strip yang terbuka - bagian area tanpa sumber blit - jadi damage.
+        void scroll(const basic_rect<int>& area, int dx, int dy) {
+            if (is_full_dirty_ || area.w <= 0 || area.h <= 0 || (dx == 0 && dy == 0)) return;
+
+            Region view(area);
+            if (has_bounds()) view.intersect(bounds_);
+            if (view.is_empty()) return;
+
+            merge_pending();
+            Region moved = damage_ & view;
+            if (!moved.is_empty()) {
+                damage_.subtract(view);
+                moved.translate(dx, dy);
+                damage_.unite(moved & view);
+            }
+
+            Region source = view;
+            source.translate(dx, dy);
+            damage_.unite(view - source);
+            resolved_ = false;
+        }
+
+        void mark_full_dirty() {
+            is_full_dirty_ = true;
+            pending_.clear();
+            damage_.clear();
+            resolved_ = false;
+        }
+
+        void clear() {
+            pending_.clear();
+            damage_.clear();
+            coalesced_.clear();
+            paint_region_.clear();
+            is_full_dirty_ = false;
+            escalated_full_ = false;
+            resolved_ = true;
+        }
+
+        bool is_dirty() const noexcept {
+            return is_full_dirty_ || !pending_.empty() || !damage_.is_empty();
+        }
+
+        // Termasuk kasus damage yang di-eskalasi karena full redraw lebih murah
+        bool is_full_dirty() const {
+            resolve();
+            return is_full_dirty_ || escalated_full_;
+        }
+
+        // Damage eksak (sebelum coalescing); di atas max_exact_rects berupa
+        // union hasil bucket. Saat full dirty = seluruh bounds.
+        const Region& get_region() const {
+            resolve();
+            if (is_full_dirty_) {
+                full_region_ = Region(bounds_);
+                return full_region_;
+            }
+            return damage_;
+        }
+
+        // Rect yang harus di-repaint setelah coalescing; kosong saat full dirty
+        const std::vector<basic_rect<int>>& get_regions() const {
+            resolve();
+            return coalesced_;
+        }
+
+        // Union dari get_regions(), untuk satu pass render dengan region clip
+        const Region& get_paint_region() const {
+            resolve();
+            return paint_region_;
+        }
+
+        // Jumlah piksel yang akan dicat frame ini
+        int64_t get_paint_area() const {
+            resolve();
+            if (is_full_dirty_ || escalated_full_) {
+                return static_cast<int64_t>(bounds_.w) * bounds_.h;
+            }
+            int64_t total = 0;
+            for (const auto& rect : coalesced_) {
+                total += static_cast<int64_t>(rect.w) * rect.h;
+            }
+            return total;
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,472 @@
+#pragma once
+
+#include "canvas.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace zuu::widget {
+
+    // DisplayList - Canvas yang tidak menggambar, tapi merekam setiap call
+    // sebagai command POD ke satu arena byte yang kontigu. Hasilnya bisa di-
+    // replay ke backend mana pun (D2DCanvas, SoftwareCanvas, DisplayList lain),
+    // dibangun di luar UI thread, di-cache per widget, atau sekadar dihitung.
+    //
+    // Teks, path dan region clip disimpan di vector terpisah; command hanya memegang
+    // index, jadi replay bisa meneruskan string tanpa alokasi. TextFormat* direkam apa adanya, jadi
+    // format harus tetap hidup sampai replay selesai.
+    class DisplayList : public Canvas {
+    public:
+        enum class Op : uint8_t {
+            Clear,
+            DrawLine,
+            DrawRect,
+            FillRect,
+            DrawRoundedRect,
+            FillRoundedRect,
+            DrawEllipse,
+            FillEllipse,
+            DrawText,
+            DrawCachedText,
+            FillRects,
+            DrawLines,
+            FillRoundedRects,
+            FillPath,
+            StrokePath,
+            PushClip,
+            PushClipRegion,
+            PopClip,
+            Save,
+            Restore,
+            SetTransform,
+            Count
+        };
+
+    private:
+        struct Header {
+            Op op;
+            uint8_t reserved[3];
+            uint32_t size;      // Ukuran payload dalam byte
+        };
+
+        struct ClearCmd { ColorU8 color; };
+        struct LineCmd { basic_point<float> start, end; ColorU8 color; float width; };
+        struct RectCmd { basic_rect<float> rect; ColorU8 color; float width; };
+        struct RoundedRectCmd { basic_rect<float> rect; float radius_x, radius_y; ColorU8 color; float width; };
+        struct EllipseCmd { basic_point<float> center; float radius_x, radius_y; ColorU8 color; float width; };
+        struct TextCmd { basic_rect<float> rect; ColorU8 color; TextFormat* format; uint32_t index; };
+        struct ClipCmd { basic_rect<float> rect; };
+        struct ClipRegionCmd { uint32_t index; };
+        struct SpanCmd { uint32_t offset, count; };
+        struct PathCmd { uint32_t index; ColorU8 color; FillRule rule; StrokeStyle stroke; Transform transform; };
+        struct TransformCmd { Transform transform; };
+
+        std::vector<std::byte> arena_;
+        std::vector<std::wstring> strings_;
+        size_t string_count_{0};        // strings_ dipakai ulang setelah reset()
+        size_t text_bytes_{0};
+        std::vector<Path> paths_;
+        size_t path_count_{0};          // Sama seperti strings_
+        size_t path_bytes_{0};
+        std::vector<Region> regions_;
+        std::vector<RectColor> rect_colors_;            // Elemen batch primitive,
+        std::vector<LineSeg> line_segs_;                // command memegang offset + count
+        std::vector<RoundedRectColor> rounded_rects_;
+        uint32_t command_count_{0};
+        uint32_t op_counts_[static_cast<size_t>(Op::Count)]{};
+        Canvas* measure_target_{nullptr};
+
+        void append(Op op) {
+            append_raw(op, nullptr, 0);
+        }
+
+        template <typename Cmd>
+        void append(Op op, const Cmd& cmd) {
+            static_assert(std::is_trivially_copyable_v<Cmd>, "display list commands must be POD");
+            append_raw(op, &cmd, sizeof(Cmd));
+        }
+
+        void append_raw(Op op, const void* payload, uint32_t size) {
+            Header header{op, {}, size};
+            size_t at = arena_.size();
+            arena_.resize(at + sizeof(Header) + size);
+            std::memcpy(arena_.data() + at, &header, sizeof(Header));
+            if (size) {
+                std::memcpy(arena_.data() + at + sizeof(Header), payload, size);
+            }
+            ++command_count_;
+            ++op_counts_[static_cast<size_t>(op)];
+        }
+
+        template <typename T>
+        void append_span(Op op, std::vector<T>& storage, std::span<const T> items) {
+            if (items.empty()) return;
+            auto offset = static_cast<uint32_t>(storage.size());
+            storage.insert(storage.end(), items.begin(), items.end());
+            append(op, SpanCmd{offset, static_cast<uint32_t>(items.size())});
+        }
+
+        void append_text(Op op, const std::wstring& text, const basic_rect<float>& rect,
+            ColorU8 color, TextFormat* text_format) {
+            if (string_count_ == strings_.size()) {
+                strings_.emplace_back();
+            }
+            strings_[string_count_].assign(text);   // Pakai ulang kapasitas string lama
+            text_bytes_ += text.size() * sizeof(wchar_t);
+
+            append(op, TextCmd{rect, color, text_format, static_cast<uint32_t>(string_count_++)});
+        }
+
+        uint32_t store_path(const Path& path) {
+            if (path_count_ == paths_.size()) {
+                paths_.emplace_back();
+            }
+            paths_[path_count_] = path;
+            path_bytes_ += path.points().size() * sizeof(basic_point<float>) + path.verbs().size();
+            return static_cast<uint32_t>(path_count_++);
+        }
+
+        template <typename Cmd>
+        static Cmd read(const std::byte* payload) noexcept {
+            Cmd cmd;
+            std::memcpy(&cmd, payload, sizeof(Cmd));
+            return cmd;
+        }
+
+    public:
+        DisplayList() = default;
+
+        DisplayList(DisplayList&&) = default;
+        DisplayList& operator=(DisplayList&&) = default;
+
+        // Kosongkan tanpa melepas kapasitas arena (dipakai ulang per frame)
+        void reset() noexcept {
+            arena_.clear();
+            string_count_ = 0;
+            text_bytes_ = 0;
+            path_count_ = 0;
+            path_bytes_ = 0;
+            regions_.clear();
+            rect_colors_.clear();
+            line_segs_.clear();
+            rounded_rects_.clear();
+            command_count_ = 0;
+            std::fill(std::begin(op_counts_), std::end(op_counts_), 0u);
+            transform_ = Transform::identity();
+            state_stack_.clear();
+        }
+
+        // Basic drawing operations
+        void clear(ColorU8 color) override {
+            append(Op::Clear, ClearCmd{color});
+        }
+
+        void draw_line(
+            const basic_point<float>& start,
+            const basic_point<float>& end,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            append(Op::DrawLine, LineCmd{start, end, color, width});
+        }
+
+        void draw_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            append(Op::DrawRect, RectCmd{rect, color, width});
+        }
+
+        void fill_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color
+        ) override {
+            append(Op::FillRect, RectCmd{rect, color, 0.0f});
+        }
+
+        void draw_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            append(Op::DrawRoundedRect, RoundedRectCmd{rect, radius_x, radius_y, color, width});
+        }
+
+        void fill_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            append(Op::FillRoundedRect, RoundedRectCmd{rect, radius_x, radius_y, color, 0.0f});
+        }
+
+        void draw_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            append(Op::DrawEllipse, EllipseCmd{center, radius_x, radius_y, color, width});
+        }
+
+        void fill_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            append(Op::FillEllipse, EllipseCmd{center, radius_x, radius_y, color, 0.0f});
+        }
+
+        void draw_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            append_text(Op::DrawText, text, rect, color, text_format);
+        }
+
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            append_text(Op::DrawCachedText, text, rect, color, text_format);
+        }
+
+        // DisplayList tidak punya font: pengukuran diteruskan ke canvas
+        // tujuan replay (set_measure_target), kalau tidak ada pakai
+        // estimasi default Canvas
+        TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) override {
+            if (measure_target_) return measure_target_->measure_text(text, text_format, advances);
+            return Canvas::measure_text(text, text_format, advances);
+        }
+
+        // Canvas yang dipakai measure_text selama merekam; tidak dimiliki
+        void set_measure_target(Canvas* target) noexcept {
+            measure_target_ = target;
+        }
+
+        void fill_path(
+            const Path& path,
+            ColorU8 color,
+            FillRule rule = FillRule::NonZero,
+            const Transform& transform = Transform::identity()
+        ) override {
+            append(Op::FillPath, PathCmd{store_path(path), color, rule, StrokeStyle{}, transform});
+        }
+
+        void stroke_path(
+            const Path& path,
+            ColorU8 color,
+            const StrokeStyle& style = StrokeStyle{},
+            const Transform& transform = Transform::identity()
+        ) override {
+            append(Op::StrokePath, PathCmd{store_path(path), color, FillRule::NonZero, style, transform});
+        }
+
+        using Canvas::fill_rects;
+
+        // Batch primitive direkam sebagai satu command
+        void fill_rects(std::span<const RectColor> rects) override {
+            append_span(Op::FillRects, rect_colors_, rects);
+        }
+
+        void draw_lines(std::span<const LineSeg> lines) override {
+            append_span(Op::DrawLines, line_segs_, lines);
+        }
+
+        void fill_rounded_rects(std::span<const RoundedRectColor> rects) override {
+            append_span(Op::FillRoundedRects, rounded_rects_, rects);
+        }
+
+        // Clipping
+        void push_clip(const basic_rect<float>& rect) override {
+            append(Op::PushClip, ClipCmd{rect});
+        }
+
+        void push_clip_region(const Region& region) override {
+            regions_.push_back(region);
+            append(Op::PushClipRegion, ClipRegionCmd{static_cast<uint32_t>(regions_.size() - 1)});
+        }
+
+        void pop_clip() override {
+            append(Op::PopClip);
+        }
+
+        // Save/restore dan transform direkam apa adanya; state lokal hanya
+        // dilacak supaya get_transform() benar selama perekaman
+        void save() override {
+            state_stack_.push_back(SavedState{transform_, 0});
+            append(Op::Save);
+        }
+
+        void restore() override {
+            if (!state_stack_.empty()) {
+                transform_ = state_stack_.back().transform;
+                state_stack_.pop_back();
+            }
+            append(Op::Restore);
+        }
+
+        void set_transform(const Transform& transform) override {
+            transform_ = transform;
+            append(Op::SetTransform, TransformCmd{transform});
+        }
+
+        bool is_valid() const noexcept override {
+            return true;
+        }
+
+        // Jalankan ulang semua command, berurutan, ke target. Transform yang
+        // direkam relatif terhadap transform target saat replay dimulai.
+        void replay(Canvas& target) const {
+            const Transform base = target.get_transform();
+            const std::byte* cursor = arena_.data();
+            const std::byte* end = cursor + arena_.size();
+
+            while (cursor < end) {
+                Header header;
+                std::memcpy(&header, cursor, sizeof(Header));
+                const std::byte* payload = cursor + sizeof(Header);
+                cursor = payload + header.size;
+
+                switch (header.op) {
+                    case Op::Clear: {
+                        auto cmd = read<ClearCmd>(payload);
+                        target.clear(cmd.color);
+                        break;
+                    }
+                    case Op::DrawLine: {
+                        auto cmd = read<LineCmd>(payload);
+                        target.draw_line(cmd.start, cmd.end, cmd.color, cmd.width);
+                        break;
+                    }
+                    case Op::DrawRect: {
+                        auto cmd = read<RectCmd>(payload);
+                        target.draw_rect(cmd.rect, cmd.color, cmd.width);
+                        break;
+                    }
+                    case Op::FillRect: {
+                        auto cmd = read<RectCmd>(payload);
+                        target.fill_rect(cmd.rect, cmd.color);
+                        break;
+                    }
+                    case Op::DrawRoundedRect: {
+                        auto cmd = read<RoundedRectCmd>(payload);
+                        target.draw_rounded_rect(cmd.rect, cmd.radius_x, cmd.radius_y, cmd.color, cmd.width);
+                        break;
+                    }
+                    case Op::FillRoundedRect: {
+                        auto cmd = read<RoundedRectCmd>(payload);
+                        target.fill_rounded_rect(cmd.rect, cmd.radius_x, cmd.radius_y, cmd.color);
+                        break;
+                    }
+                    case Op::DrawEllipse: {
+                        auto cmd = read<EllipseCmd>(payload);
+                        target.draw_ellipse(cmd.center, cmd.radius_x, cmd.radius_y, cmd.color, cmd.width);
+                        break;
+                    }
+                    case Op::FillEllipse: {
+                        auto cmd = read<EllipseCmd>(payload);
+                        target.fill_ellipse(cmd.center, cmd.radius_x, cmd.radius_y, cmd.color);
+                        break;
+                    }
+                    case Op::DrawText: {
+                        auto cmd = read<TextCmd>(payload);
+                        target.draw_text(strings_[cmd.index], cmd.rect, cmd.color, cmd.format);
+                        break;
+                    }
+                    case Op::DrawCachedText: {
+                        auto cmd = read<TextCmd>(payload);
+                        target.draw_cached_text(strings_[cmd.index], cmd.rect, cmd.color, cmd.format);
+                        break;
+                    }
+                    case Op::FillRects: {
+                        auto cmd = read<SpanCmd>(payload);
+                        target.fill_rects(std::span<const RectColor>(rect_colors_.data() + cmd.offset, cmd.count));
+                        break;
+                    }
+                    case Op::DrawLines: {
+                        auto cmd = read<SpanCmd>(payload);
+                        target.draw_lines(std::span<const LineSeg>(line_segs_.data() + cmd.offset, cmd.count));
+                        break;
+                    }
+                    case Op::FillRoundedRects: {
+                        auto cmd = read<SpanCmd>(payload);
+                        target.fill_rounded_rects(
+                            std::span<const RoundedRectColor>(rounded_rects_.data() + cmd.offset, cmd.count));
+                        break;
+                    }
+                    case Op::FillPath: {
+                        auto cmd = read<PathCmd>(payload);
+                        target.fill_path(paths_[cmd.index], cmd.color, cmd.rule, cmd.transform);
+                        break;
+                    }
+                    case Op::StrokePath: {
+                        auto cmd = read<PathCmd>(payload);
+                        target.stroke_path(paths_[cmd.index], cmd.color, cmd.stroke, cmd.transform);
+                        break;
+                    }
+                    case Op::PushClip: {
+                        auto cmd = read<ClipCmd>(payload);
+                        target.push_clip(cmd.rect);
+                        break;
+                    }
+                    case Op::PushClipRegion: {
+                        auto cmd = read<ClipRegionCmd>(payload);
+                        target.push_clip_region(regions_[cmd.index]);
+                        break;
+                    }
+                    case Op::PopClip:
+                        target.pop_clip();
+                        break;
+                    case Op::Save:
+                        target.save();
+                        break;
+                    case Op::Restore:
+                        target.restore();
+                        break;
+                    case Op::SetTransform: {
+                        auto cmd = read<TransformCmd>(payload);
+                        target.set_transform(cmd.transform * base);
+                        break;
+                    }
+                    case Op::Count:
+                        break;
+                }
+            }
+        }
+
+        // Statistik rekaman
+        bool empty() const noexcept { return command_count_ == 0; }
+        size_t command_count() const noexcept { return command_count_; }
+        size_t command_count(Op op) const noexcept { return op_counts_[static_cast<size_t>(op)]; }
+
+        // Total memori command + teks + path + elemen batch (tanpa region)
+        size_t byte_size() const noexcept {
+            return arena_.size() + text_bytes_ + path_bytes_
+                + rect_colors_.size() * sizeof(RectColor)
+                + line_segs_.size() * sizeof(LineSeg)
+                + rounded_rects_.size() * sizeof(RoundedRectColor);
+        }
+    };
+
+} // namespace zuu::widget
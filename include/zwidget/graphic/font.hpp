@@ -0,0 +1,674 @@
+#pragma once
+
+#include "glyph_atlas.hpp"
+#include "path.hpp"
+#include "path_rasterizer.hpp"
+#include "text_format.hpp"
+#include "transform.hpp"
+#include "zwidget/detail/mapped_file.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwctype>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace zuu::widget {
+
+    namespace detail {
+
+        // Potongan data font big-endian. Semua baca di-bounds-check: offset
+        // di luar data menghasilkan 0, jadi font rusak tidak bisa membaca
+        // keluar buffer (paling buruk glyph kosong / salah).
+        struct SfntSpan {
+            const uint8_t* data{nullptr};
+            size_t size{0};
+
+            bool has(size_t offset, size_t length) const noexcept {
+                return offset <= size && length <= size - offset;
+            }
+
+            uint8_t u8(size_t offset) const noexcept {
+                return offset < size ? data[offset] : 0;
+            }
+
+            uint16_t u16(size_t offset) const noexcept {
+                return has(offset, 2) ? static_cast<uint16_t>(data[offset] << 8 | data[offset + 1]) : 0;
+            }
+
+            int16_t s16(size_t offset) const noexcept {
+                return static_cast<int16_t>(u16(offset));
+            }
+
+            uint32_t u32(size_t offset) const noexcept {
+                return has(offset, 4)
+                    ? uint32_t(data[offset]) << 24 | uint32_t(data[offset + 1]) << 16
+                        | uint32_t(data[offset + 2]) << 8 | data[offset + 3]
+                    : 0;
+            }
+
+            SfntSpan sub(size_t offset, size_t length) const noexcept {
+                if (!has(offset, length)) return SfntSpan{};
+                return SfntSpan{data + offset, length};
+            }
+
+            explicit operator bool() const noexcept { return size != 0; }
+        };
+
+        constexpr uint32_t sfnt_tag(const char (&tag)[5]) noexcept {
+            return uint32_t(uint8_t(tag[0])) << 24 | uint32_t(uint8_t(tag[1])) << 16
+                | uint32_t(uint8_t(tag[2])) << 8 | uint8_t(tag[3]);
+        }
+
+    } // namespace detail
+
+    // Font TrueType (glyf) dari file .ttf / .otf / .ttc. Tabel yang dipakai:
+    // cmap (format 0, 4, 6, 12), glyf/loca (simple + composite), hmtx/hhea,
+    // kern (format 0) dan name/OS/2 untuk family, weight, italic. OTF dengan
+    // outline CFF tidak didukung (load gagal). Data dibaca langsung dari
+    // file yang di-mmap; Font immutable setelah load, aman dipakai banyak
+    // thread sekaligus.
+    class Font {
+    public:
+        // Metrik vertikal dalam pixel pada ukuran tertentu (descent positif)
+        struct Metrics {
+            float ascent{0.0f};
+            float descent{0.0f};
+            float line_gap{0.0f};
+
+            float line_height() const noexcept { return ascent + descent + line_gap; }
+        };
+
+    private:
+        using Span = detail::SfntSpan;
+
+        std::shared_ptr<const void> owner_;         // Pemilik byte font (MappedFile / buffer)
+        Span glyf_, loca_, hmtx_;
+        Span cmap_;                                 // Subtable terpilih
+        Span kern_;                                 // Pasangan kern format 0 (6 byte per pasangan)
+        uint16_t cmap_format_{0};
+        bool cmap_symbol_{false};
+        bool long_loca_{false};
+        uint16_t units_per_em_{1000};
+        uint16_t glyph_count_{0};
+        uint16_t hmetric_count_{0};
+        int16_t ascender_{0};
+        int16_t descender_{0};
+        int16_t line_gap_{0};
+        std::wstring family_;
+        uint16_t weight_{400};
+        bool italic_{false};
+        uint64_t id_{0};
+
+        // Font units -> pixel: x' = a x + c y + e, y' = b x + d y + f
+        struct Affine {
+            float a, b, c, d, e, f;
+
+            basic_point<float> apply(float x, float y) const noexcept {
+                return basic_point<float>(a * x + c * y + e, b * x + d * y + f);
+            }
+
+            // this setelah inner (inner dulu)
+            Affine operator*(const Affine& inner) const noexcept {
+                return Affine{
+                    a * inner.a + c * inner.b, b * inner.a + d * inner.b,
+                    a * inner.c + c * inner.d, b * inner.c + d * inner.d,
+                    a * inner.e + c * inner.f + e, b * inner.e + d * inner.f + f};
+            }
+        };
+
+        struct OutlinePoint {
+            int32_t x, y;
+            bool on;
+        };
+
+        Font() = default;
+
+        static uint64_t next_id() noexcept {
+            static std::atomic<uint64_t> counter{1};
+            return counter.fetch_add(1, std::memory_order_relaxed) | 0x8000000000000000ull;
+        }
+
+        // Subtable cmap Unicode terbaik: format 12 > format 4 > symbol > 6 / 0
+        void select_cmap(const Span& cmap) {
+            int best = -1;
+            uint16_t count = cmap.u16(2);
+            for (uint16_t i = 0; i < count; ++i) {
+                size_t record = 4 + size_t(i) * 8;
+                uint16_t platform = cmap.u16(record);
+                uint16_t encoding = cmap.u16(record + 2);
+                uint32_t offset = cmap.u32(record + 4);
+                uint16_t format = cmap.u16(offset);
+                bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+                bool symbol = platform == 3 && encoding == 0;
+
+                int score = -1;
+                if (format == 12 && unicode) score = 4;
+                else if (format == 4 && unicode) score = 3;
+                else if (format == 4 && symbol) score = 2;
+                else if (format == 6 || format == 0) score = 1;
+                if (score <= best) continue;
+
+                size_t length = format == 12 ? cmap.u32(offset + 4) : cmap.u16(offset + 2);
+                Span table = cmap.sub(offset, length);
+                if (!table) continue;
+                best = score;
+                cmap_ = table;
+                cmap_format_ = format;
+                cmap_symbol_ = symbol;
+            }
+        }
+
+        // Subtable kern horizontal format 0 pertama (versi Microsoft)
+        void select_kern(const Span& kern) {
+            if (kern.u16(0) != 0) return;
+            uint16_t count = kern.u16(2);
+            size_t p = 4;
+            for (uint16_t i = 0; i < count && kern.has(p, 6); ++i) {
+                uint16_t length = kern.u16(p + 2);
+                uint16_t coverage = kern.u16(p + 4);
+                if ((coverage >> 8) == 0 && (coverage & 0x7) == 1) {
+                    uint16_t pairs = kern.u16(p + 6);
+                    kern_ = kern.sub(p + 14, size_t(pairs) * 6);
+                    return;
+                }
+                if (length < 6) return;
+                p += length;
+            }
+        }
+
+        // Family dari tabel name (nameID 1): Windows Unicode, lalu Mac Roman
+        void read_family(const Span& name) {
+            uint16_t count = name.u16(2);
+            size_t strings = name.u16(4);
+            int best = 0;
+            for (uint16_t i = 0; i < count; ++i) {
+                size_t record = 6 + size_t(i) * 12;
+                uint16_t platform = name.u16(record);
+                uint16_t language = name.u16(record + 4);
+                if (name.u16(record + 6) != 1) continue;
+
+                int score = platform == 3 ? (language == 0x409 ? 4 : 3) : platform == 0 ? 2 : platform == 1 ? 1 : 0;
+                if (score <= best) continue;
+                Span text = name.sub(strings + name.u16(record + 10), name.u16(record + 8));
+                if (!text) continue;
+
+                best = score;
+                family_.clear();
+                if (platform == 1) {
+                    for (size_t c = 0; c < text.size; ++c) family_.push_back(static_cast<wchar_t>(text.data[c]));
+                } else {
+                    for (size_t c = 0; c + 1 < text.size; c += 2) family_.push_back(static_cast<wchar_t>(text.u16(c)));
+                }
+            }
+        }
+
+        bool load(const uint8_t* data, size_t size, uint32_t face_index) {
+            Span file{data, size};
+            size_t directory = 0;
+            if (file.u32(0) == detail::sfnt_tag("ttcf")) {
+                if (face_index >= file.u32(8)) return false;
+                directory = file.u32(12 + size_t(face_index) * 4);
+            }
+
+            uint32_t version = file.u32(directory);
+            if (version != 0x00010000 && version != detail::sfnt_tag("true")) return false;
+
+            Span head, hhea, maxp, cmap, kern, name, os2;
+            uint16_t tables = file.u16(directory + 4);
+            for (uint16_t i = 0; i < tables; ++i) {
+                size_t record = directory + 12 + size_t(i) * 16;
+                uint32_t tag = file.u32(record);
+                Span table = file.sub(file.u32(record + 8), file.u32(record + 12));
+                if (tag == detail::sfnt_tag("head")) head = table;
+                else if (tag == detail::sfnt_tag("hhea")) hhea = table;
+                else if (tag == detail::sfnt_tag("maxp")) maxp = table;
+                else if (tag == detail::sfnt_tag("hmtx")) hmtx_ = table;
+                else if (tag == detail::sfnt_tag("loca")) loca_ = table;
+                else if (tag == detail::sfnt_tag("glyf")) glyf_ = table;
+                else if (tag == detail::sfnt_tag("cmap")) cmap = table;
+                else if (tag == detail::sfnt_tag("kern")) kern = table;
+                else if (tag == detail::sfnt_tag("name")) name = table;
+                else if (tag == detail::sfnt_tag("OS/2")) os2 = table;
+            }
+            if (!head || !hhea || !maxp || !hmtx_ || !loca_ || !glyf_ || !cmap) return false;
+            if (head.u32(12) != 0x5F0F3CF5) return false;
+
+            units_per_em_ = head.u16(18);
+            long_loca_ = head.s16(50) != 0;
+            glyph_count_ = maxp.u16(4);
+            hmetric_count_ = hhea.u16(34);
+            ascender_ = hhea.s16(4);
+            descender_ = hhea.s16(6);
+            line_gap_ = hhea.s16(8);
+            if (units_per_em_ == 0 || glyph_count_ == 0 || hmetric_count_ == 0) return false;
+            if (!loca_.has(0, (size_t(glyph_count_) + 1) * (long_loca_ ? 4 : 2))) return false;
+            if (!hmtx_.has(0, size_t(hmetric_count_) * 4)) return false;
+
+            select_cmap(cmap);
+            if (!cmap_) return false;
+            if (kern) select_kern(kern);
+            if (name) read_family(name);
+            if (os2) {
+                weight_ = os2.u16(4) ? os2.u16(4) : 400;
+                italic_ = (os2.u16(62) & 1) != 0;
+            } else {
+                weight_ = (head.u16(44) & 1) ? 700 : 400;
+                italic_ = (head.u16(44) & 2) != 0;
+            }
+            id_ = next_id();
+            return true;
+        }
+
+        // Range byte glyph di glyf; length 0 = glyph tanpa outline
+        bool glyph_range(uint32_t glyph, size_t& offset, size_t& length) const noexcept {
+            if (glyph >= glyph_count_) return false;
+            size_t begin = long_loca_ ? loca_.u32(size_t(glyph) * 4) : size_t(loca_.u16(size_t(glyph) * 2)) * 2;
+            size_t end = long_loca_ ? loca_.u32(size_t(glyph + 1) * 4) : size_t(loca_.u16(size_t(glyph + 1) * 2)) * 2;
+            if (end < begin || !glyf_.has(begin, end - begin)) return false;
+            offset = begin;
+            length = end - begin;
+            return true;
+        }
+
+        // Kontur TrueType (quadratic B-spline, titik on/off curve) -> path;
+        // dua titik off berurutan punya titik on implisit di tengahnya
+        static void append_contour(const OutlinePoint* pts, size_t count, const Affine& m, Path& out) {
+            if (count < 2) return;
+            auto at = [&](size_t i) { return m.apply(static_cast<float>(pts[i].x), static_cast<float>(pts[i].y)); };
+            auto mid = [](basic_point<float> a, basic_point<float> b) {
+                return basic_point<float>((a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f);
+            };
+
+            basic_point<float> start, control;
+            bool pending = false;
+            if (pts[0].on) {
+                start = at(0);
+            } else {
+                start = pts[count - 1].on ? at(count - 1) : mid(at(0), at(count - 1));
+                control = at(0);
+                pending = true;
+            }
+            out.move_to(start.x, start.y);
+
+            for (size_t i = 1; i < count; ++i) {
+                basic_point<float> p = at(i);
+                if (pts[i].on) {
+                    if (pending) out.quad_to(control.x, control.y, p.x, p.y);
+                    else out.line_to(p.x, p.y);
+                    pending = false;
+                } else {
+                    if (pending) {
+                        basic_point<float> m2 = mid(control, p);
+                        out.quad_to(control.x, control.y, m2.x, m2.y);
+                    }
+                    control = p;
+                    pending = true;
+                }
+            }
+            if (pending) out.quad_to(control.x, control.y, start.x, start.y);
+            out.close();
+        }
+
+        bool append_simple(const Span& g, int contours, const Affine& m, Path& out) const {
+            thread_local std::vector<OutlinePoint> points;
+            thread_local std::vector<uint8_t> flags;
+            thread_local std::vector<uint16_t> ends;
+
+            ends.resize(static_cast<size_t>(contours));
+            for (int i = 0; i < contours; ++i) ends[i] = g.u16(10 + size_t(i) * 2);
+            size_t count = size_t(ends[contours - 1]) + 1;
+            size_t p = 10 + size_t(contours) * 2;
+            p += 2 + g.u16(p);
+
+            // Flag dengan repeat, lalu delta x dan y
+            flags.resize(count);
+            for (size_t i = 0; i < count;) {
+                if (p >= g.size) return false;
+                uint8_t flag = g.u8(p++);
+                size_t repeat = (flag & 8) ? size_t(g.u8(p++)) + 1 : 1;
+                for (; repeat && i < count; --repeat) flags[i++] = flag;
+            }
+
+            points.resize(count);
+            int32_t x = 0, y = 0;
+            for (size_t i = 0; i < count; ++i) {
+                uint8_t flag = flags[i];
+                if (flag & 2) {
+                    x += (flag & 16) ? g.u8(p) : -int32_t(g.u8(p));
+                    p += 1;
+                } else if (!(flag & 16)) {
+                    x += g.s16(p);
+                    p += 2;
+                }
+                points[i].x = x;
+                points[i].on = (flag & 1) != 0;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                uint8_t flag = flags[i];
+                if (flag & 4) {
+                    y += (flag & 32) ? g.u8(p) : -int32_t(g.u8(p));
+                    p += 1;
+                } else if (!(flag & 32)) {
+                    y += g.s16(p);
+                    p += 2;
+                }
+                points[i].y = y;
+            }
+            if (p > g.size) return false;
+
+            size_t first = 0;
+            for (int i = 0; i < contours; ++i) {
+                size_t last = ends[i];
+                if (last < first || last >= count) return false;
+                append_contour(points.data() + first, last - first + 1, m, out);
+                first = last + 1;
+            }
+            return true;
+        }
+
+        bool append_glyph(uint32_t glyph, const Affine& m, Path& out, int depth) const {
+            size_t offset = 0, length = 0;
+            if (depth > 8 || !glyph_range(glyph, offset, length)) return false;
+            if (length == 0) return true;
+
+            Span g = glyf_.sub(offset, length);
+            int contours = g.s16(0);
+            if (contours > 0) return append_simple(g, contours, m, out);
+            if (contours == 0) return true;
+
+            // Composite: komponen dengan offset dan (opsional) skala / matrix 2x2.
+            // Penempatan lewat pencocokan titik tidak didukung (offset 0).
+            size_t p = 10;
+            for (;;) {
+                if (!g.has(p, 4)) return false;
+                uint16_t flags = g.u16(p);
+                uint16_t component = g.u16(p + 2);
+                p += 4;
+
+                float dx, dy;
+                if (flags & 0x0001) {
+                    dx = g.s16(p);
+                    dy = g.s16(p + 2);
+                    p += 4;
+                } else {
+                    dx = static_cast<int8_t>(g.u8(p));
+                    dy = static_cast<int8_t>(g.u8(p + 1));
+                    p += 2;
+                }
+                if (!(flags & 0x0002)) dx = dy = 0.0f;
+
+                auto f2dot14 = [&](size_t at) { return g.s16(at) / 16384.0f; };
+                Affine local{1.0f, 0.0f, 0.0f, 1.0f, dx, dy};
+                if (flags & 0x0008) {
+                    local.a = local.d = f2dot14(p);
+                    p += 2;
+                } else if (flags & 0x0040) {
+                    local.a = f2dot14(p);
+                    local.d = f2dot14(p + 2);
+                    p += 4;
+                } else if (flags & 0x0080) {
+                    local.a = f2dot14(p);
+                    local.b = f2dot14(p + 2);
+                    local.c = f2dot14(p + 4);
+                    local.d = f2dot14(p + 6);
+                    p += 8;
+                }
+
+                if (!append_glyph(component, m * local, out, depth + 1)) return false;
+                if (!(flags & 0x0020)) return true;
+            }
+        }
+
+    public:
+        Font(const Font&) = delete;
+        Font& operator=(const Font&) = delete;
+
+        // Font dari file (di-mmap, tidak disalin). face_index untuk .ttc.
+        // nullptr kalau file tidak ada atau bukan font TrueType yang valid.
+        static std::shared_ptr<Font> from_file(const std::string& path, uint32_t face_index = 0) {
+            auto file = detail::MappedFile::open(path);
+            if (!file) return nullptr;
+            std::shared_ptr<Font> font(new Font());
+            if (!font->load(file->data(), file->size(), face_index)) return nullptr;
+            font->owner_ = std::move(file);
+            return font;
+        }
+
+        static std::shared_ptr<Font> from_memory(std::vector<uint8_t> bytes, uint32_t face_index = 0) {
+            auto data = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+            std::shared_ptr<Font> font(new Font());
+            if (!font->load(data->data(), data->size(), face_index)) return nullptr;
+            font->owner_ = std::move(data);
+            return font;
+        }
+
+        // Glyph untuk codepoint; 0 (.notdef) kalau tidak ada
+        uint32_t glyph_index(char32_t codepoint) const noexcept {
+            uint32_t c = codepoint;
+            const Span& t = cmap_;
+            switch (cmap_format_) {
+                case 0:
+                    return c < 256 ? t.u8(6 + c) : 0;
+                case 6: {
+                    uint32_t first = t.u16(6);
+                    return c >= first && c - first < t.u16(8) ? t.u16(10 + size_t(c - first) * 2) : 0;
+                }
+                case 4: {
+                    if (cmap_symbol_ && c < 0x100) c |= 0xF000;
+                    if (c > 0xFFFF) return 0;
+                    size_t segments = t.u16(6) / 2;
+                    size_t ends = 14, starts = 16 + segments * 2;
+                    size_t deltas = starts + segments * 2, ranges = deltas + segments * 2;
+
+                    // Segmen pertama dengan end >= c
+                    size_t lo = 0, hi = segments;
+                    while (lo < hi) {
+                        size_t mid = (lo + hi) / 2;
+                        if (t.u16(ends + mid * 2) < c) lo = mid + 1;
+                        else hi = mid;
+                    }
+                    if (lo >= segments || t.u16(starts + lo * 2) > c) return 0;
+
+                    uint16_t delta = t.u16(deltas + lo * 2);
+                    uint16_t range = t.u16(ranges + lo * 2);
+                    if (range == 0) return (c + delta) & 0xFFFF;
+                    uint16_t glyph = t.u16(ranges + lo * 2 + range + (c - t.u16(starts + lo * 2)) * 2);
+                    return glyph ? (glyph + delta) & 0xFFFF : 0;
+                }
+                case 12: {
+                    size_t lo = 0, hi = t.u32(12);
+                    while (lo < hi) {
+                        size_t mid = (lo + hi) / 2;
+                        size_t group = 16 + mid * 12;
+                        if (t.u32(group + 4) < c) lo = mid + 1;
+                        else if (t.u32(group) > c) hi = mid;
+                        else return t.u32(group + 8) + (c - t.u32(group));
+                    }
+                    return 0;
+                }
+                default:
+                    return 0;
+            }
+        }
+
+        float scale(float size) const noexcept {
+            return size / units_per_em_;
+        }
+
+        float advance(uint32_t glyph, float size) const noexcept {
+            size_t metric = std::min<size_t>(glyph, hmetric_count_ - 1u);
+            return hmtx_.u16(metric * 4) * scale(size);
+        }
+
+        // Penyesuaian jarak pasangan glyph (kern format 0), pixel
+        float kerning(uint32_t left, uint32_t right, float size) const noexcept {
+            if (!kern_ || left == 0 || right == 0) return 0.0f;
+            uint32_t key = left << 16 | right;
+            size_t lo = 0, hi = kern_.size / 6;
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                uint32_t pair = kern_.u32(mid * 6);
+                if (pair < key) lo = mid + 1;
+                else if (pair > key) hi = mid;
+                else return kern_.s16(mid * 6 + 4) * scale(size);
+            }
+            return 0.0f;
+        }
+
+        Metrics metrics(float size) const noexcept {
+            float s = scale(size);
+            return Metrics{ascender_ * s, -descender_ * s, line_gap_ * s};
+        }
+
+        // Outline glyph dalam pixel (y ke bawah) dengan pen di (x, baseline),
+        // ditambahkan ke out. false kalau data glyph rusak.
+        bool outline(uint32_t glyph, float size, float x, float baseline, Path& out) const {
+            float s = scale(size);
+            return append_glyph(glyph, Affine{s, 0.0f, 0.0f, -s, x, baseline}, out, 0);
+        }
+
+        // Bounding box outline dari header glyf (mencakup titik off-curve,
+        // jadi juga kurvanya), pixel relatif pen / baseline dengan y ke
+        // bawah. false untuk glyph tanpa outline (spasi) atau data rusak.
+        bool glyph_bounds(uint32_t glyph, float size, basic_rect<float>& out) const noexcept {
+            size_t offset = 0, length = 0;
+            if (!glyph_range(glyph, offset, length) || length < 10) return false;
+            float s = scale(size);
+            float x0 = glyf_.s16(offset + 2) * s, y1 = -glyf_.s16(offset + 4) * s;
+            float x1 = glyf_.s16(offset + 6) * s, y0 = -glyf_.s16(offset + 8) * s;
+            out = basic_rect<float>(x0, y0, x1 - x0, y1 - y0);
+            return true;
+        }
+
+        // Mask coverage AA glyph, pen di (subpixel, 0); bitmap kosong untuk
+        // glyph tanpa outline. Scratch per thread, aman dari worker tile.
+        GlyphBitmap rasterize(uint32_t glyph, float size, float subpixel = 0.0f) const {
+            struct Scratch {
+                Path path;
+                std::vector<Contour> contours;
+                PathRasterizer rasterizer;
+                CoverageMask mask;
+            };
+            thread_local Scratch scratch;
+
+            GlyphBitmap bitmap;
+            bitmap.advance = advance(glyph, size);
+            scratch.path.clear();
+            if (!outline(glyph, size, subpixel, 0.0f, scratch.path) || scratch.path.empty()) return bitmap;
+
+            scratch.path.flatten(0.2f, scratch.contours);
+            scratch.rasterizer.reset();
+            for (const Contour& contour : scratch.contours) {
+                scratch.rasterizer.add_contour(contour, Transform::identity());
+            }
+            scratch.rasterizer.build(FillRule::NonZero, scratch.mask);
+            if (scratch.mask.empty()) return bitmap;
+
+            int x0 = scratch.mask.runs.front().x0, x1 = scratch.mask.runs.front().x1;
+            int y0 = scratch.mask.runs.front().y, y1 = scratch.mask.runs.back().y + 1;
+            for (const auto& run : scratch.mask.runs) {
+                x0 = std::min(x0, run.x0);
+                x1 = std::max(x1, run.x1);
+            }
+
+            bitmap.left = x0;
+            bitmap.top = y0;
+            bitmap.width = x1 - x0;
+            bitmap.height = y1 - y0;
+            bitmap.coverage.assign(static_cast<size_t>(bitmap.width) * bitmap.height, 0);
+            for (const auto& run : scratch.mask.runs) {
+                uint8_t* row = bitmap.coverage.data() + static_cast<size_t>(run.y - y0) * bitmap.width - x0;
+                if (run.offset < 0) {
+                    std::memset(row + run.x0, run.alpha, static_cast<size_t>(run.x1 - run.x0));
+                } else {
+                    std::memcpy(row + run.x0, scratch.mask.alphas.data() + run.offset, static_cast<size_t>(run.x1 - run.x0));
+                }
+            }
+            return bitmap;
+        }
+
+        const std::wstring& family() const noexcept { return family_; }
+        uint16_t weight() const noexcept { return weight_; }
+        bool italic() const noexcept { return italic_; }
+        uint16_t units_per_em() const noexcept { return units_per_em_; }
+        uint32_t glyph_count() const noexcept { return glyph_count_; }
+        bool has_kerning() const noexcept { return static_cast<bool>(kern_); }
+
+        // Identitas unik per Font yang di-load (key GlyphAtlas)
+        uint64_t id() const noexcept { return id_; }
+    };
+
+    // FontCollection - font yang bisa dipakai SoftwareCanvas::draw_text.
+    // Dicocokkan lewat family (case-insensitive), lalu weight / italic
+    // terdekat; family yang tidak terdaftar jatuh ke font pertama.
+    class FontCollection {
+    private:
+        mutable std::mutex mutex_;
+        std::vector<std::shared_ptr<Font>> fonts_;
+
+        static bool same_family(const std::wstring& a, const std::wstring& b) noexcept {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](wchar_t x, wchar_t y) {
+                return std::towlower(x) == std::towlower(y);
+            });
+        }
+
+    public:
+        FontCollection() = default;
+
+        FontCollection(const FontCollection&) = delete;
+        FontCollection& operator=(const FontCollection&) = delete;
+
+        static FontCollection& global() {
+            static FontCollection collection;
+            return collection;
+        }
+
+        void add(std::shared_ptr<Font> font) {
+            if (!font) return;
+            std::lock_guard lock(mutex_);
+            fonts_.push_back(std::move(font));
+        }
+
+        // Load + daftarkan; nullptr kalau gagal
+        std::shared_ptr<Font> add_file(const std::string& path, uint32_t face_index = 0) {
+            auto font = Font::from_file(path, face_index);
+            add(font);
+            return font;
+        }
+
+        // nullptr kalau koleksi kosong
+        std::shared_ptr<Font> find(const FontQuery& query) const {
+            std::lock_guard lock(mutex_);
+            const std::shared_ptr<Font>* best = nullptr;
+            int best_score = 0;
+            for (const auto& font : fonts_) {
+                if (!same_family(font->family(), query.family)) continue;
+                int score = 0x10000 - std::abs(int(font->weight()) - int(query.weight))
+                    - (font->italic() != query.italic ? 1000 : 0);
+                if (!best || score > best_score) {
+                    best = &font;
+                    best_score = score;
+                }
+            }
+            if (best) return *best;
+            return fonts_.empty() ? nullptr : fonts_.front();
+        }
+
+        void clear() {
+            std::lock_guard lock(mutex_);
+            fonts_.clear();
+        }
+
+        size_t size() const {
+            std::lock_guard lock(mutex_);
+            return fonts_.size();
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace zuu::widget {
+
+    // Counter per frame, di-reset oleh Renderer::render sebelum draw_func
+    // dipanggil. Dipakai untuk memverifikasi efek culling, cache dan batching.
+    struct FrameStats {
+        uint32_t widgets_visited{0};    // Child yang diperiksa Container::render
+        uint32_t widgets_drawn{0};      // Child yang benar-benar di-render
+        uint32_t widgets_cached{0};     // Yang di-replay dari display list cache
+        uint32_t widgets_occluded{0};   // Dilewati karena tertutup sibling opaque
+        uint64_t occluded_pixels{0};    // Piksel damage milik widget yang dilewati itu
+
+        uint32_t draw_calls{0};             // Primitive yang diminta widget
+        uint32_t submitted_draw_calls{0};   // Call ke backend setelah batching
+        uint32_t batches{0};                // Kelompok state hasil sorting
+        uint32_t tiles{0};                  // Tile non-kosong yang di-raster (mode tiled)
+        uint32_t culled_draw_calls{0};      // Primitive di luar clip, ditolak sebelum submit
+
+        uint32_t path_cache_hits{0};        // Path yang cukup di-blit dari cache geometri
+        uint32_t path_cache_misses{0};      // Path yang di-flatten + rasterize ulang
+
+        uint32_t text_layout_hits{0};       // draw_cached_text yang memakai layout dari cache
+        uint32_t text_layout_misses{0};     // Yang harus di-layout ulang
+
+        uint32_t layer_cache_hits{0};       // Subtree CacheAsLayer yang cukup dikomposit
+        uint32_t layer_cache_misses{0};     // Subtree yang di-render ulang ke layer
+
+        void reset() noexcept {
+            *this = FrameStats{};
+        }
+    };
+
+} // namespace zuu::widget
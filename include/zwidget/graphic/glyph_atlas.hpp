@@ -0,0 +1,297 @@
+#pragma once
+
+#include "zwidget/detail/hash.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Hasil raster satu glyph: coverage A8, posisi relatif terhadap pen
+    // (x, pixel penuh) dan baseline (y, ke bawah positif; top biasanya negatif)
+    struct GlyphBitmap {
+        int width{0};
+        int height{0};
+        int left{0};
+        int top{0};
+        float advance{0.0f};
+        std::vector<uint8_t> coverage;              // width * height, baris rapat
+    };
+
+    // Identitas glyph di atlas. size dalam 1/4 pixel, subpixel = offset x
+    // pen dalam langkah 1 / GlyphAtlas::subpixel_steps.
+    struct GlyphKey {
+        uint64_t font{0};
+        uint32_t glyph{0};
+        uint16_t size{0};
+        uint8_t subpixel{0};
+
+        bool operator==(const GlyphKey&) const = default;
+    };
+
+    struct GlyphKeyHash {
+        size_t operator()(const GlyphKey& key) const noexcept {
+            detail::StateHasher hasher;
+            hasher.add(key.font).add(key.glyph).add(static_cast<uint32_t>(key.size) << 8 | key.subpixel);
+            return static_cast<size_t>(hasher.value());
+        }
+    };
+
+    // GlyphAtlas - cache mask coverage glyph untuk SoftwareCanvas.
+    // Mask dipack ke halaman A8 page_size x page_size dengan shelf packing.
+    // Total halaman dibatasi byte budget per proses; kalau penuh, halaman
+    // yang paling lama tidak dipakai di-evict utuh (LRU per halaman) beserta
+    // semua glyph di dalamnya. Glyph yang sudah di-lookup memegang pixel
+    // halamannya (shared_ptr), jadi worker tile lain aman mem-blit walau
+    // halaman itu di-evict di tengah jalan.
+    class GlyphAtlas {
+    public:
+        static constexpr int page_size = 256;
+        static constexpr int subpixel_shift = 2;
+        static constexpr int subpixel_steps = 1 << subpixel_shift;
+        static constexpr size_t page_bytes = static_cast<size_t>(page_size) * page_size;
+
+        // View glyph siap blit; coverage baris ke-i = coverage + i * stride
+        struct Glyph {
+            std::shared_ptr<const uint8_t[]> pixels;
+            const uint8_t* coverage{nullptr};
+            int stride{0};
+            int width{0};
+            int height{0};
+            int left{0};
+            int top{0};
+            float advance{0.0f};
+
+            bool empty() const noexcept { return width <= 0 || height <= 0; }
+        };
+
+    private:
+        static constexpr uint16_t no_page = 0xFFFF;
+
+        struct Slot {
+            uint16_t page;
+            uint16_t x, y;
+            uint16_t width, height;
+            int16_t left, top;
+            float advance;
+        };
+
+        struct Shelf {
+            int y;
+            int height;
+            int x;                                  // Kolom bebas berikutnya
+        };
+
+        struct Page {
+            std::shared_ptr<uint8_t[]> pixels;
+            std::vector<Shelf> shelves;
+            std::vector<GlyphKey> keys;             // Glyph yang tinggal di halaman ini
+            int next_y{0};
+            uint64_t last_used{0};
+        };
+
+        mutable std::mutex mutex_;
+        std::vector<Page> pages_;
+        std::unordered_map<GlyphKey, Slot, GlyphKeyHash> index_;
+        size_t budget_{4u << 20};
+        uint64_t tick_{0};
+        uint64_t hits_{0};
+        uint64_t misses_{0};
+        uint64_t evictions_{0};
+
+        Glyph view(const Slot& slot) {
+            Glyph glyph;
+            glyph.width = slot.width;
+            glyph.height = slot.height;
+            glyph.left = slot.left;
+            glyph.top = slot.top;
+            glyph.advance = slot.advance;
+            if (slot.page == no_page) return glyph;
+
+            Page& page = pages_[slot.page];
+            page.last_used = ++tick_;
+            glyph.pixels = page.pixels;
+            glyph.coverage = page.pixels.get() + static_cast<size_t>(slot.y) * page_size + slot.x;
+            glyph.stride = page_size;
+            return glyph;
+        }
+
+        // Shelf dengan tinggi paling pas (tidak lebih dari 1.5x glyph),
+        // atau shelf baru di bawah shelf terakhir
+        static bool pack(Page& page, int width, int height, int& x, int& y) {
+            Shelf* best = nullptr;
+            for (Shelf& shelf : page.shelves) {
+                if (shelf.height < height || shelf.height > height + height / 2 + 2) continue;
+                if (shelf.x + width > page_size) continue;
+                if (!best || shelf.height < best->height) best = &shelf;
+            }
+            if (!best) {
+                int shelf_height = std::min((height + 3) & ~3, page_size - page.next_y);
+                if (shelf_height < height) return false;
+                page.shelves.push_back(Shelf{page.next_y, shelf_height, 0});
+                page.next_y += shelf_height;
+                best = &page.shelves.back();
+            }
+            x = best->x;
+            y = best->y;
+            best->x += width;
+            return true;
+        }
+
+        // Kosongkan halaman; buffer lama tetap hidup selama masih dipegang Glyph
+        void reset(Page& page) {
+            for (const GlyphKey& key : page.keys) index_.erase(key);
+            page.keys.clear();
+            page.shelves.clear();
+            page.next_y = 0;
+            if (page.pixels.use_count() > 1) {
+                page.pixels = std::make_shared_for_overwrite<uint8_t[]>(page_bytes);
+            }
+        }
+
+        void remove_page(size_t index) {
+            reset(pages_[index]);
+            pages_.erase(pages_.begin() + static_cast<std::ptrdiff_t>(index));
+            for (auto& [key, slot] : index_) {
+                if (slot.page != no_page && slot.page > index) --slot.page;
+            }
+        }
+
+        size_t lru_page() const {
+            size_t oldest = 0;
+            for (size_t i = 1; i < pages_.size(); ++i) {
+                if (pages_[i].last_used < pages_[oldest].last_used) oldest = i;
+            }
+            return oldest;
+        }
+
+        // Cari tempat di halaman yang ada, tambah halaman selama budget
+        // cukup, atau evict halaman LRU
+        size_t allocate(int width, int height, int& x, int& y) {
+            for (size_t i = pages_.size(); i-- > 0;) {
+                if (pack(pages_[i], width, height, x, y)) return i;
+            }
+            if (pages_.empty() || (pages_.size() + 1) * page_bytes <= budget_) {
+                pages_.push_back(Page{std::make_shared_for_overwrite<uint8_t[]>(page_bytes), {}, {}, 0, 0});
+                pack(pages_.back(), width, height, x, y);
+                return pages_.size() - 1;
+            }
+            size_t victim = lru_page();
+            reset(pages_[victim]);
+            ++evictions_;
+            pack(pages_[victim], width, height, x, y);
+            return victim;
+        }
+
+        Glyph insert(const GlyphKey& key, GlyphBitmap&& bitmap) {
+            Slot slot{no_page, 0, 0, 0, 0,
+                static_cast<int16_t>(bitmap.left), static_cast<int16_t>(bitmap.top), bitmap.advance};
+            bool empty = bitmap.width <= 0 || bitmap.height <= 0;
+
+            // Lebih besar dari satu halaman: tidak di-cache, blit langsung
+            if (!empty && (bitmap.width > page_size || bitmap.height > page_size)) {
+                Glyph glyph;
+                auto pixels = std::make_shared_for_overwrite<uint8_t[]>(bitmap.coverage.size());
+                std::memcpy(pixels.get(), bitmap.coverage.data(), bitmap.coverage.size());
+                glyph.pixels = pixels;
+                glyph.coverage = pixels.get();
+                glyph.stride = glyph.width = bitmap.width;
+                glyph.height = bitmap.height;
+                glyph.left = bitmap.left;
+                glyph.top = bitmap.top;
+                glyph.advance = bitmap.advance;
+                return glyph;
+            }
+
+            if (!empty) {
+                int x = 0, y = 0;
+                size_t page = allocate(bitmap.width, bitmap.height, x, y);
+                uint8_t* dst = pages_[page].pixels.get() + static_cast<size_t>(y) * page_size + x;
+                for (int row = 0; row < bitmap.height; ++row) {
+                    std::memcpy(dst + static_cast<size_t>(row) * page_size,
+                        bitmap.coverage.data() + static_cast<size_t>(row) * bitmap.width,
+                        static_cast<size_t>(bitmap.width));
+                }
+                pages_[page].keys.push_back(key);
+                slot.page = static_cast<uint16_t>(page);
+                slot.x = static_cast<uint16_t>(x);
+                slot.y = static_cast<uint16_t>(y);
+                slot.width = static_cast<uint16_t>(bitmap.width);
+                slot.height = static_cast<uint16_t>(bitmap.height);
+            }
+            return view(index_.emplace(key, slot).first->second);
+        }
+
+        void trim() {
+            while (pages_.size() > 1 && pages_.size() * page_bytes > budget_) {
+                remove_page(lru_page());
+                ++evictions_;
+            }
+        }
+
+    public:
+        GlyphAtlas() = default;
+
+        GlyphAtlas(const GlyphAtlas&) = delete;
+        GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+        static GlyphAtlas& global() {
+            static GlyphAtlas atlas;
+            return atlas;
+        }
+
+        // Glyph dari cache; kalau miss, rasterize() -> GlyphBitmap dipanggil
+        // di luar lock lalu hasilnya dipack ke atlas
+        template <typename Rasterize>
+        Glyph lookup(const GlyphKey& key, Rasterize&& rasterize) {
+            {
+                std::lock_guard lock(mutex_);
+                if (auto it = index_.find(key); it != index_.end()) {
+                    ++hits_;
+                    return view(it->second);
+                }
+                ++misses_;
+            }
+
+            GlyphBitmap bitmap = rasterize();
+            std::lock_guard lock(mutex_);
+            if (auto it = index_.find(key); it != index_.end()) {
+                return view(it->second);             // Thread lain lebih dulu
+            }
+            return insert(key, std::move(bitmap));
+        }
+
+        void clear() {
+            std::lock_guard lock(mutex_);
+            pages_.clear();
+            index_.clear();
+        }
+
+        // Budget berlaku untuk seluruh proses (atlas global); minimal satu
+        // halaman selalu dipertahankan
+        void set_byte_budget(size_t bytes) {
+            std::lock_guard lock(mutex_);
+            budget_ = bytes;
+            trim();
+        }
+
+        void reset_stats() {
+            std::lock_guard lock(mutex_);
+            hits_ = misses_ = evictions_ = 0;
+        }
+
+        size_t byte_budget() const { std::lock_guard lock(mutex_); return budget_; }
+        size_t bytes_held() const { std::lock_guard lock(mutex_); return pages_.size() * page_bytes; }
+        size_t page_count() const { std::lock_guard lock(mutex_); return pages_.size(); }
+        size_t size() const { std::lock_guard lock(mutex_); return index_.size(); }
+        uint64_t hits() const { std::lock_guard lock(mutex_); return hits_; }
+        uint64_t misses() const { std::lock_guard lock(mutex_); return misses_; }
+        uint64_t evictions() const { std::lock_guard lock(mutex_); return evictions_; }
+    };
+
+} // namespace zuu::widget
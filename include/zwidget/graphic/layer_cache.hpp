@@ -0,0 +1,139 @@
+#pragma once
+
+#include "canvas.hpp"
+#include "zwidget/unit/rect.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace zuu::widget {
+
+    // LayerCache - pemilik semua layer offscreen WidgetFlag::CacheAsLayer.
+    // Satu entry per widget (owner), dengan budget memori global: kalau
+    // total byte melewati budget, entry yang paling lama tidak dikomposit
+    // di-evict (LRU). Widget yang layernya di-evict cukup render ulang ke
+    // layer baru di frame berikutnya. Entry mencatat device pembuatnya
+    // (Canvas::layer_device), jadi renderer yang kehilangan device hanya
+    // membuang layernya sendiri.
+    class LayerCache {
+    private:
+        struct Entry {
+            const void* owner;
+            const void* device;
+            std::shared_ptr<Canvas> canvas;
+            basic_rect<int> bounds;
+            size_t bytes;
+        };
+
+        using List = std::list<Entry>;
+
+        mutable std::mutex mutex_;
+        List lru_;                                          // Depan = paling baru dipakai
+        std::unordered_map<const void*, List::iterator> index_;
+        size_t budget_{64u << 20};
+        size_t bytes_{0};
+        uint64_t hits_{0};
+        uint64_t misses_{0};
+        uint64_t evictions_{0};
+
+        static size_t bytes_of(const basic_rect<int>& bounds) noexcept {
+            return static_cast<size_t>(bounds.w) * static_cast<size_t>(bounds.h) * 4u;
+        }
+
+        void erase(List::iterator it) {
+            bytes_ -= it->bytes;
+            index_.erase(it->owner);
+            lru_.erase(it);
+        }
+
+        // Evict dari belakang sampai muat; entry terdepan (baru masuk) dipertahankan
+        void trim() {
+            while (bytes_ > budget_ && lru_.size() > 1) {
+                erase(std::prev(lru_.end()));
+                ++evictions_;
+            }
+        }
+
+    public:
+        LayerCache() = default;
+
+        LayerCache(const LayerCache&) = delete;
+        LayerCache& operator=(const LayerCache&) = delete;
+
+        static LayerCache& global() {
+            static LayerCache cache;
+            return cache;
+        }
+
+        // Layer owner yang masih valid untuk device dan bounds ini, atau
+        // nullptr. Bounds berbeda (widget pindah / resize) atau device lain
+        // (widget pindah window) dianggap miss.
+        std::shared_ptr<Canvas> find(const void* owner, const void* device, const basic_rect<int>& bounds) {
+            std::lock_guard lock(mutex_);
+            auto it = index_.find(owner);
+            if (it == index_.end() || it->second->device != device || it->second->bounds != bounds) return nullptr;
+
+            lru_.splice(lru_.begin(), lru_, it->second);
+            ++hits_;
+            return lru_.front().canvas;
+        }
+
+        // Simpan layer yang baru di-render (menggantikan milik owner sebelumnya)
+        std::shared_ptr<Canvas> insert(const void* owner, const void* device, const basic_rect<int>& bounds,
+            std::unique_ptr<Canvas> canvas) {
+            std::lock_guard lock(mutex_);
+            ++misses_;
+            if (auto it = index_.find(owner); it != index_.end()) {
+                erase(it->second);
+            }
+
+            lru_.push_front(Entry{owner, device, std::shared_ptr<Canvas>(std::move(canvas)), bounds, bytes_of(bounds)});
+            index_[owner] = lru_.begin();
+            bytes_ += lru_.front().bytes;
+            trim();
+            return lru_.front().canvas;
+        }
+
+        void release(const void* owner) {
+            std::lock_guard lock(mutex_);
+            if (auto it = index_.find(owner); it != index_.end()) {
+                erase(it->second);
+            }
+        }
+
+        // Buang layer milik satu device (renderer dihancurkan / device hilang)
+        void release_device(const void* device) {
+            std::lock_guard lock(mutex_);
+            for (auto it = lru_.begin(); it != lru_.end();) {
+                auto next = std::next(it);
+                if (it->device == device) erase(it);
+                it = next;
+            }
+        }
+
+        // Buang semua layer
+        void clear() {
+            std::lock_guard lock(mutex_);
+            lru_.clear();
+            index_.clear();
+            bytes_ = 0;
+        }
+
+        void set_byte_budget(size_t bytes) {
+            std::lock_guard lock(mutex_);
+            budget_ = bytes;
+            trim();
+        }
+
+        size_t byte_budget() const { std::lock_guard lock(mutex_); return budget_; }
+        size_t bytes_held() const { std::lock_guard lock(mutex_); return bytes_; }
+        size_t size() const { std::lock_guard lock(mutex_); return lru_.size(); }
+        uint64_t hits() const { std::lock_guard lock(mutex_); return hits_; }
+        uint64_t misses() const { std::lock_guard lock(mutex_); return misses_; }
+        uint64_t evictions() const { std::lock_guard lock(mutex_); return evictions_; }
+    };
+
+} // namespace zuu::widget
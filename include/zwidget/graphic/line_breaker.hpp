@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace zuu::widget {
+
+    // LineBreaker - word wrap untuk teks yang sudah diukur. set_text()
+    // memindai break opportunity sekali per string (subset UAX #14: setelah
+    // spasi / tab, setelah tanda hubung, di antara ideograf CJK; '\n' wajib)
+    // jadi segmen "kata + spasi di belakangnya" dengan posisi x prefix sum.
+    // wrap(width) lalu cukup satu binary search per baris: O(lines log n),
+    // dan tidak melakukan apa-apa kalau lebarnya sama dengan sebelumnya.
+    // Kata yang lebih lebar dari baris dipecah per karakter.
+    class LineBreaker {
+    public:
+        // Satu baris: code unit [begin, end) tanpa spasi di ujung kanan
+        struct Line {
+            size_t begin;
+            size_t end;
+            float width;
+        };
+
+    private:
+        struct Segment {
+            size_t word_end;                        // Akhir bagian terlihat
+            size_t next;                            // Awal segmen berikutnya (setelah spasi / '\n')
+            float word_end_x;                       // carets_[word_end]
+            uint32_t hard_end;                      // Segmen wajib-putus pertama >= segmen ini
+            bool mandatory;
+        };
+
+        std::vector<float> carets_{0.0f};           // carets_[i] = x sebelum code unit i
+        std::vector<Segment> segments_;
+        std::vector<Line> lines_;
+        float wrap_width_{-1.0f};
+
+        static bool is_space(wchar_t ch) noexcept {
+            return ch == L' ' || ch == L'\t' || ch == L'\r' || ch == 0x3000;
+        }
+
+        static bool is_hyphen(wchar_t ch) noexcept {
+            return ch == L'-' || ch == 0x2010 || ch == 0x2013 || ch == 0x2014;
+        }
+
+        static bool is_ideograph(wchar_t ch) noexcept {
+            return (ch >= 0x3040 && ch < 0x3100) || (ch >= 0x3400 && ch < 0xA000)
+                || (ch >= 0xAC00 && ch < 0xD7B0) || (ch >= 0xF900 && ch < 0xFB00);
+        }
+
+        void push(size_t word_end, size_t next, bool mandatory) {
+            segments_.push_back(Segment{word_end, next, carets_[word_end], 0, mandatory});
+        }
+
+        // Largest q in (p, end] dengan carets_[q] - x0 <= width, minimal satu
+        // unit; unit ber-advance 0 (low surrogate) ikut unit sebelumnya
+        size_t fit_units(size_t p, size_t end, float x0, float width) const {
+            auto first = carets_.begin() + static_cast<std::ptrdiff_t>(p + 1);
+            auto last = carets_.begin() + static_cast<std::ptrdiff_t>(end + 1);
+            size_t q = static_cast<size_t>(std::upper_bound(first, last, x0 + width) - carets_.begin());
+            q = std::max(q - 1, p + 1);
+            while (q < end && carets_[q + 1] == carets_[q]) ++q;
+            return q;
+        }
+
+    public:
+        // advances per code unit dari Canvas::measure_text (advances.size()
+        // = text.size()). Baris yang ada dibuang; wrap() berikutnya re-flow.
+        void set_text(const std::wstring& text, std::span<const float> advances) {
+            size_t n = std::min(text.size(), advances.size());
+            carets_.resize(n + 1);
+            carets_[0] = 0.0f;
+            for (size_t i = 0; i < n; ++i) carets_[i + 1] = carets_[i] + advances[i];
+
+            segments_.clear();
+            lines_.clear();
+            wrap_width_ = -1.0f;
+
+            size_t i = 0;
+            while (i < n) {
+                wchar_t ch = text[i];
+                if (ch == L'\n') {
+                    push(i, i + 1, true);
+                    ++i;
+                } else if (is_space(ch)) {
+                    size_t word_end = i;
+                    while (i < n && is_space(text[i])) ++i;
+                    bool mandatory = i < n && text[i] == L'\n';
+                    push(word_end, mandatory ? ++i : i, mandatory);
+                } else {
+                    // Break tanpa spasi; sebelum spasi / '\n' ditangani cabang di atas
+                    ++i;
+                    if (i < n && !is_space(text[i]) && text[i] != L'\n'
+                        && (is_hyphen(ch) || is_ideograph(ch) || is_ideograph(text[i]))) {
+                        push(i, i, false);
+                    }
+                }
+            }
+            if (segments_.empty() || segments_.back().mandatory || segments_.back().next < n) {
+                push(n, n, false);
+            }
+
+            uint32_t hard = static_cast<uint32_t>(segments_.size() - 1);
+            for (size_t k = segments_.size(); k-- > 0;) {
+                if (segments_[k].mandatory) hard = static_cast<uint32_t>(k);
+                segments_[k].hard_end = hard;
+            }
+        }
+
+        // Re-flow greedy ke width; true kalau baris berubah (width beda)
+        bool wrap(float width) {
+            width = std::max(width, 0.0f);
+            if (width == wrap_width_) return false;
+            wrap_width_ = width;
+            lines_.clear();
+
+            size_t p = 0;
+            size_t k = 0;
+            while (k < segments_.size()) {
+                const Segment& seg = segments_[k];
+                float x0 = carets_[p];
+
+                // Segmen terakhir di [k, hard_end] yang kata-nya masih muat
+                auto first = segments_.begin() + static_cast<std::ptrdiff_t>(k);
+                auto last = segments_.begin() + static_cast<std::ptrdiff_t>(seg.hard_end + 1);
+                auto fit = std::upper_bound(first, last, x0 + width, [](float limit, const Segment& s) {
+                    return limit < s.word_end_x;
+                });
+
+                if (fit != first) {
+                    const Segment& end = *std::prev(fit);
+                    lines_.push_back(Line{p, end.word_end, end.word_end_x - x0});
+                    p = end.next;
+                    k = static_cast<size_t>(fit - segments_.begin());
+                } else if (seg.word_end <= p) {
+                    lines_.push_back(Line{p, p, 0.0f});
+                    p = seg.next;
+                    ++k;
+                } else {
+                    size_t q = fit_units(p, seg.word_end, x0, width);
+                    lines_.push_back(Line{p, q, carets_[q] - x0});
+                    p = q;
+                    if (q == seg.word_end) {
+                        p = seg.next;
+                        ++k;
+                    }
+                }
+            }
+            return true;
+        }
+
+        const std::vector<Line>& lines() const noexcept { return lines_; }
+        size_t segment_count() const noexcept { return segments_.size(); }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "transform.hpp"
+#include "zwidget/detail/hash.hpp"
+#include "zwidget/unit/point.hpp"
+#include "zwidget/unit/rect.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace zuu::widget {
+
+    enum class FillRule : uint8_t {
+        NonZero,
+        EvenOdd
+    };
+
+    enum class LineCap : uint8_t {
+        Flat,       // Default D2D
+        Square,
+        Round
+    };
+
+    enum class LineJoin : uint8_t {
+        Miter,      // Default D2D, jatuh ke bevel di atas miter_limit
+        Bevel,
+        Round
+    };
+
+    struct StrokeStyle {
+        float width{1.0f};
+        LineCap cap{LineCap::Flat};
+        LineJoin join{LineJoin::Miter};
+        float miter_limit{10.0f};
+
+        constexpr bool operator==(const StrokeStyle&) const noexcept = default;
+    };
+
+    // Polyline hasil flattening; closed = kembali ke titik awal
+    struct Contour {
+        std::vector<basic_point<float>> points;
+        bool closed{false};
+    };
+
+    // Path - urutan verb (move/line/quad/cubic/close) dengan titik kontrolnya,
+    // dalam koordinat user. Geometri di-cache backend berdasarkan hash(),
+    // jadi path yang dibangun sekali dan digambar tiap frame hanya
+    // di-tessellate sekali.
+    class Path {
+    public:
+        enum class Verb : uint8_t {
+            Move,
+            Line,
+            Quad,
+            Cubic,
+            Close
+        };
+
+    private:
+        std::vector<Verb> verbs_;
+        std::vector<basic_point<float>> points_;
+        mutable uint64_t hash_{0};
+        mutable bool hash_valid_{false};
+
+        void ensure_started() {
+            if (verbs_.empty() || verbs_.back() == Verb::Close) {
+                basic_point<float> start = points_.empty() ? basic_point<float>() : last_move_point();
+                move_to(start.x, start.y);
+            }
+        }
+
+        basic_point<float> last_move_point() const noexcept {
+            size_t index = 0, point = 0;
+            for (size_t i = 0; i < verbs_.size(); ++i) {
+                if (verbs_[i] == Verb::Move) index = point;
+                point += point_count(verbs_[i]);
+            }
+            return points_[index];
+        }
+
+        static constexpr size_t point_count(Verb verb) noexcept {
+            switch (verb) {
+                case Verb::Move:
+                case Verb::Line: return 1;
+                case Verb::Quad: return 2;
+                case Verb::Cubic: return 3;
+                default: return 0;
+            }
+        }
+
+        // Jumlah segmen agar deviasi dari kurva <= tolerance (rumus Wang)
+        static int segments_for(float deviation, float factor, float tolerance) noexcept {
+            float n = std::ceil(std::sqrt(factor * deviation / tolerance));
+            return std::clamp(static_cast<int>(n), 1, 256);
+        }
+
+        static float length(float x, float y) noexcept {
+            return std::sqrt(x * x + y * y);
+        }
+
+    public:
+        Path() = default;
+
+        Path& move_to(float x, float y) {
+            verbs_.push_back(Verb::Move);
+            points_.emplace_back(x, y);
+            hash_valid_ = false;
+            return *this;
+        }
+
+        Path& line_to(float x, float y) {
+            ensure_started();
+            verbs_.push_back(Verb::Line);
+            points_.emplace_back(x, y);
+            hash_valid_ = false;
+            return *this;
+        }
+
+        Path& quad_to(float cx, float cy, float x, float y) {
+            ensure_started();
+            verbs_.push_back(Verb::Quad);
+            points_.emplace_back(cx, cy);
+            points_.emplace_back(x, y);
+            hash_valid_ = false;
+            return *this;
+        }
+
+        Path& cubic_to(float c1x, float c1y, float c2x, float c2y, float x, float y) {
+            ensure_started();
+            verbs_.push_back(Verb::Cubic);
+            points_.emplace_back(c1x, c1y);
+            points_.emplace_back(c2x, c2y);
+            points_.emplace_back(x, y);
+            hash_valid_ = false;
+            return *this;
+        }
+
+        Path& close() {
+            if (!verbs_.empty() && verbs_.back() != Verb::Close) {
+                verbs_.push_back(Verb::Close);
+                hash_valid_ = false;
+            }
+            return *this;
+        }
+
+        void clear() noexcept {
+            verbs_.clear();
+            points_.clear();
+            hash_valid_ = false;
+        }
+
+        bool empty() const noexcept { return verbs_.empty(); }
+        const std::vector<Verb>& verbs() const noexcept { return verbs_; }
+        const std::vector<basic_point<float>>& points() const noexcept { return points_; }
+
+        // Identitas geometri untuk cache (verb + titik)
+        uint64_t hash() const noexcept {
+            if (!hash_valid_) {
+                detail::StateHasher hasher;
+                hasher.add(verbs_.size());
+                hasher.add_bytes(verbs_.data(), verbs_.size() * sizeof(Verb));
+                hasher.add_bytes(points_.data(), points_.size() * sizeof(basic_point<float>));
+                hash_ = hasher.value();
+                hash_valid_ = true;
+            }
+            return hash_;
+        }
+
+        // Bounding box titik kontrol (selalu memuat kurvanya)
+        basic_rect<float> bounds() const noexcept {
+            if (points_.empty()) return basic_rect<float>();
+            float x0 = points_[0].x, y0 = points_[0].y, x1 = x0, y1 = y0;
+            for (const auto& p : points_) {
+                x0 = std::min(x0, p.x);
+                y0 = std::min(y0, p.y);
+                x1 = std::max(x1, p.x);
+                y1 = std::max(y1, p.y);
+            }
+            return basic_rect<float>(x0, y0, x1 - x0, y1 - y0);
+        }
+
+        // Pecah kurva jadi polyline dengan deviasi maks tolerance (satuan
+        // koordinat path). Titik berurutan yang sama dibuang.
+        void flatten(float tolerance, std::vector<Contour>& out) const {
+            out.clear();
+            tolerance = std::max(tolerance, 1e-3f);
+
+            auto push = [&](float x, float y) {
+                auto& pts = out.back().points;
+                if (pts.empty() || pts.back().x != x || pts.back().y != y) {
+                    pts.emplace_back(x, y);
+                }
+            };
+
+            size_t p = 0;
+            basic_point<float> current;
+            for (Verb verb : verbs_) {
+                switch (verb) {
+                    case Verb::Move:
+                        current = points_[p++];
+                        out.emplace_back();
+                        push(current.x, current.y);
+                        break;
+                    case Verb::Line:
+                        current = points_[p++];
+                        push(current.x, current.y);
+                        break;
+                    case Verb::Quad: {
+                        auto c = points_[p], e = points_[p + 1];
+                        p += 2;
+                        float dev = length(current.x - 2 * c.x + e.x, current.y - 2 * c.y + e.y);
+                        int n = segments_for(dev, 0.25f, tolerance);
+                        for (int i = 1; i <= n; ++i) {
+                            float t = static_cast<float>(i) / n, u = 1 - t;
+                            push(u * u * current.x + 2 * u * t * c.x + t * t * e.x,
+                                 u * u * current.y + 2 * u * t * c.y + t * t * e.y);
+                        }
+                        current = e;
+                        break;
+                    }
+                    case Verb::Cubic: {
+                        auto c1 = points_[p], c2 = points_[p + 1], e = points_[p + 2];
+                        p += 3;
+                        float dev = std::max(
+                            length(current.x - 2 * c1.x + c2.x, current.y - 2 * c1.y + c2.y),
+                            length(c1.x - 2 * c2.x + e.x, c1.y - 2 * c2.y + e.y));
+                        int n = segments_for(dev, 0.75f, tolerance);
+                        for (int i = 1; i <= n; ++i) {
+                            float t = static_cast<float>(i) / n, u = 1 - t;
+                            float a = u * u * u, b = 3 * u * u * t, cc = 3 * u * t * t, d = t * t * t;
+                            push(a * current.x + b * c1.x + cc * c2.x + d * e.x,
+                                 a * current.y + b * c1.y + cc * c2.y + d * e.y);
+                        }
+                        current = e;
+                        break;
+                    }
+                    case Verb::Close:
+                        if (!out.empty()) {
+                            out.back().closed = true;
+                            auto& pts = out.back().points;
+                            if (pts.size() > 1 && pts.front().x == pts.back().x && pts.front().y == pts.back().y) {
+                                pts.pop_back();
+                            }
+                            current = pts.empty() ? current : pts.front();
+                        }
+                        break;
+                }
+            }
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,421 @@
+#pragma once
+
+#include "path.hpp"
+#include "zwidget/detail/hash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <numbers>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Hasil rasterisasi path: run coverage per baris, koordinat relatif ke
+    // origin integer mask. Run dengan offset < 0 punya alpha konstan (interior),
+    // selain itu alpha per pixel ada di alphas[offset ...].
+    struct CoverageMask {
+        struct Run {
+            int y;
+            int x0, x1;
+            int32_t offset;
+            uint8_t alpha;
+        };
+
+        std::vector<Run> runs;
+        std::vector<uint8_t> alphas;
+
+        void clear() noexcept {
+            runs.clear();
+            alphas.clear();
+        }
+
+        bool empty() const noexcept { return runs.empty(); }
+
+        size_t byte_size() const noexcept {
+            return runs.size() * sizeof(Run) + alphas.size();
+        }
+    };
+
+    namespace detail {
+
+        // Stroker: contour (koordinat user) -> polygon tertutup yang di-fill
+        // nonzero. Sisi kiri maju + sisi kanan mundur; join dalam lewat titik
+        // pivot supaya overlap-nya tetap winding positif.
+        class Stroker {
+        private:
+            using Point = basic_point<float>;
+
+            const StrokeStyle& style_;
+            float half_;
+            float tolerance_;
+            std::vector<Contour>& out_;
+
+            static Point normal(const Point& a, const Point& b) noexcept {
+                float dx = b.x - a.x, dy = b.y - a.y;
+                float len = std::sqrt(dx * dx + dy * dy);
+                return Point(-dy / len, dx / len);
+            }
+
+            // Busur terpendek dari arah n0 ke n1, titik ujung tidak ikut
+            void arc(std::vector<Point>& pts, const Point& center, Point n0, Point n1) const {
+                float a0 = std::atan2(n0.y, n0.x);
+                float a1 = std::atan2(n1.y, n1.x);
+                float sweep = a1 - a0;
+                while (sweep > std::numbers::pi_v<float>) sweep -= 2 * std::numbers::pi_v<float>;
+                while (sweep < -std::numbers::pi_v<float>) sweep += 2 * std::numbers::pi_v<float>;
+
+                float step = 2.0f * std::acos(std::clamp(1.0f - tolerance_ / half_, -1.0f, 1.0f));
+                int n = std::clamp(static_cast<int>(std::ceil(std::fabs(sweep) / std::max(step, 1e-3f))), 1, 64);
+                for (int i = 1; i < n; ++i) {
+                    float a = a0 + sweep * i / n;
+                    pts.emplace_back(center.x + std::cos(a) * half_, center.y + std::sin(a) * half_);
+                }
+            }
+
+            // Join di vertex p antara segmen bernormal n0 lalu n1, sisi +normal
+            void join(std::vector<Point>& pts, const Point& p, const Point& n0, const Point& n1) const {
+                Point a(p.x + n0.x * half_, p.y + n0.y * half_);
+                Point b(p.x + n1.x * half_, p.y + n1.y * half_);
+                float cross = n0.x * n1.y - n0.y * n1.x;
+                float dot = n0.x * n1.x + n0.y * n1.y;
+
+                if (std::fabs(cross) < 1e-6f && dot > 0) {     // Segaris
+                    pts.push_back(a);
+                    return;
+                }
+                // Sisi dalam belokan: lewat pivot
+                if (cross > 0) {
+                    pts.push_back(a);
+                    pts.push_back(p);
+                    pts.push_back(b);
+                    return;
+                }
+
+                pts.push_back(a);
+                switch (style_.join) {
+                    case LineJoin::Round:
+                        arc(pts, p, n0, n1);
+                        break;
+                    case LineJoin::Miter: {
+                        // Panjang miter / half = 1 / cos(theta / 2)
+                        float cos_half = std::sqrt(std::max(0.0f, (1.0f + dot) * 0.5f));
+                        if (cos_half > 1e-4f && 1.0f / cos_half <= style_.miter_limit) {
+                            float mx = n0.x + n1.x, my = n0.y + n1.y;
+                            float ml = std::sqrt(mx * mx + my * my);
+                            float len = half_ / cos_half;
+                            pts.emplace_back(p.x + mx / ml * len, p.y + my / ml * len);
+                        }
+                        break;
+                    }
+                    case LineJoin::Bevel:
+                        break;
+                }
+                pts.push_back(b);
+            }
+
+            void cap(std::vector<Point>& pts, const Point& p, const Point& n) const {
+                // Dari sisi +n ke sisi -n di ujung p, arah keluar t = (n.y, -n.x)
+                Point t(n.y, -n.x);
+                switch (style_.cap) {
+                    case LineCap::Flat:
+                        pts.emplace_back(p.x + n.x * half_, p.y + n.y * half_);
+                        pts.emplace_back(p.x - n.x * half_, p.y - n.y * half_);
+                        break;
+                    case LineCap::Square:
+                        pts.emplace_back(p.x + (n.x + t.x) * half_, p.y + (n.y + t.y) * half_);
+                        pts.emplace_back(p.x + (t.x - n.x) * half_, p.y + (t.y - n.y) * half_);
+                        break;
+                    case LineCap::Round:
+                        pts.emplace_back(p.x + n.x * half_, p.y + n.y * half_);
+                        arc(pts, p, n, t);
+                        pts.emplace_back(p.x + t.x * half_, p.y + t.y * half_);
+                        arc(pts, p, t, Point(-n.x, -n.y));
+                        pts.emplace_back(p.x - n.x * half_, p.y - n.y * half_);
+                        break;
+                }
+            }
+
+            // Satu sisi contour tertutup (loop sendiri)
+            void closed_side(const std::vector<Point>& pts, bool reverse) {
+                size_t n = pts.size();
+                Contour side;
+                side.closed = true;
+                for (size_t k = 0; k < n; ++k) {
+                    size_t i = reverse ? n - 1 - k : k;
+                    const Point& prev = pts[reverse ? (i + 1) % n : (i + n - 1) % n];
+                    const Point& next = pts[reverse ? (i + n - 1) % n : (i + 1) % n];
+                    join(side.points, pts[i], normal(prev, pts[i]), normal(pts[i], next));
+                }
+                out_.push_back(std::move(side));
+            }
+
+        public:
+            Stroker(const StrokeStyle& style, float tolerance, std::vector<Contour>& out)
+                : style_(style), half_(style.width * 0.5f), tolerance_(tolerance), out_(out) {}
+
+            void stroke(const Contour& contour) {
+                const auto& pts = contour.points;
+                if (pts.empty() || half_ <= 0.0f) return;
+
+                if (pts.size() == 1) {
+                    // Titik tunggal: hanya cap square / round yang terlihat
+                    if (style_.cap == LineCap::Flat) return;
+                    Contour dot;
+                    dot.closed = true;
+                    Point n(0.0f, 1.0f);
+                    cap(dot.points, pts[0], Point(-n.x, -n.y));
+                    cap(dot.points, pts[0], n);
+                    out_.push_back(std::move(dot));
+                    return;
+                }
+
+                if (contour.closed && pts.size() > 2) {
+                    closed_side(pts, false);
+                    closed_side(pts, true);
+                    return;
+                }
+
+                // Terbuka: sisi kiri maju, cap akhir, sisi kanan mundur, cap awal
+                Contour outline;
+                outline.closed = true;
+                auto& o = outline.points;
+                size_t n = pts.size();
+
+                Point n0 = normal(pts[0], pts[1]);
+                o.emplace_back(pts[0].x + n0.x * half_, pts[0].y + n0.y * half_);
+                for (size_t i = 1; i + 1 < n; ++i) {
+                    join(o, pts[i], normal(pts[i - 1], pts[i]), normal(pts[i], pts[i + 1]));
+                }
+                cap(o, pts[n - 1], normal(pts[n - 2], pts[n - 1]));
+                for (size_t i = n - 2; i >= 1; --i) {
+                    join(o, pts[i], normal(pts[i + 1], pts[i]), normal(pts[i], pts[i - 1]));
+                }
+                cap(o, pts[0], normal(pts[1], pts[0]));
+                out_.push_back(std::move(outline));
+            }
+        };
+
+    } // namespace detail
+
+    // Rasterizer scanline dengan accumulation cell sparse: tiap segmen
+    // menyumbang (cover, area) hanya ke cell pixel yang dilewatinya; sweep
+    // per baris menghasilkan coverage eksak (luas) untuk nonzero / even-odd.
+    // Memori sebanding panjang outline, bukan luas bounding box.
+    class PathRasterizer {
+    private:
+        struct Cell {
+            int x, y;
+            float cover;    // Jumlah dy (bertanda) yang melewati cell
+            float area;     // Jumlah dy * posisi x rata-rata di dalam cell
+        };
+
+        std::vector<Cell> cells_;
+
+        void add_cell(int x, int y, float cover, float area) {
+            cells_.push_back(Cell{x, y, cover, area});
+        }
+
+        // Potongan segmen di dalam satu baris pixel
+        void add_row(int row, float xa, float xb, float dy) {
+            if (xa > xb) std::swap(xa, xb);
+            int ia = static_cast<int>(std::floor(xa));
+            int ib = static_cast<int>(std::floor(xb));
+
+            if (ia == ib || xb - xa < 1e-6f) {
+                add_cell(ia, row, dy, dy * ((xa + xb) * 0.5f - ia));
+                return;
+            }
+
+            // dy terbagi proporsional terhadap panjang x di tiap cell
+            float per_x = dy / (xb - xa);
+            for (int cx = ia; cx <= ib; ++cx) {
+                float s = std::max(xa, static_cast<float>(cx));
+                float e = std::min(xb, static_cast<float>(cx + 1));
+                if (e <= s) continue;
+                float part = per_x * (e - s);
+                add_cell(cx, row, part, part * ((s + e) * 0.5f - cx));
+            }
+        }
+
+        static uint8_t to_alpha(float winding, FillRule rule) noexcept {
+            float c = std::fabs(winding);
+            if (rule == FillRule::EvenOdd) {
+                c = std::fmod(c, 2.0f);
+                if (c > 1.0f) c = 2.0f - c;
+            }
+            if (c >= 1.0f) return 255;
+            return static_cast<uint8_t>(c * 255.0f + 0.5f);
+        }
+
+    public:
+        void reset() noexcept {
+            cells_.clear();
+        }
+
+        void add_line(basic_point<float> p0, basic_point<float> p1) {
+            if (p0.y == p1.y) return;
+            float dir = 1.0f;
+            if (p0.y > p1.y) {
+                std::swap(p0, p1);
+                dir = -1.0f;
+            }
+
+            float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+            int r0 = static_cast<int>(std::floor(p0.y));
+            int r1 = static_cast<int>(std::ceil(p1.y));
+            for (int row = r0; row < r1; ++row) {
+                float ya = std::max(p0.y, static_cast<float>(row));
+                float yb = std::min(p1.y, static_cast<float>(row + 1));
+                if (yb <= ya) continue;
+                add_row(row, p0.x + (ya - p0.y) * dxdy, p0.x + (yb - p0.y) * dxdy, (yb - ya) * dir);
+            }
+        }
+
+        // Contour selalu diperlakukan tertutup (fill)
+        void add_contour(const Contour& contour, const Transform& transform) {
+            const auto& pts = contour.points;
+            if (pts.size() < 2) return;
+            basic_point<float> first = transform.apply(pts[0]);
+            basic_point<float> prev = first;
+            for (size_t i = 1; i < pts.size(); ++i) {
+                basic_point<float> p = transform.apply(pts[i]);
+                add_line(prev, p);
+                prev = p;
+            }
+            add_line(prev, first);
+        }
+
+        // Sweep cell ke mask: urutkan (y, x), gabung cell kembar, lalu
+        // coverage(x) = acc + cover - area; di antara cell coverage = acc.
+        void build(FillRule rule, CoverageMask& mask) {
+            mask.clear();
+            std::sort(cells_.begin(), cells_.end(), [](const Cell& a, const Cell& b) {
+                return a.y != b.y ? a.y < b.y : a.x < b.x;
+            });
+
+            size_t i = 0;
+            while (i < cells_.size()) {
+                int y = cells_[i].y;
+                float acc = 0.0f;
+                CoverageMask::Run* open = nullptr;     // Run alpha per pixel yang masih bisa disambung
+
+                while (i < cells_.size() && cells_[i].y == y) {
+                    int x = cells_[i].x;
+                    float cover = 0.0f, area = 0.0f;
+                    for (; i < cells_.size() && cells_[i].y == y && cells_[i].x == x; ++i) {
+                        cover += cells_[i].cover;
+                        area += cells_[i].area;
+                    }
+
+                    uint8_t alpha = to_alpha(acc + cover - area, rule);
+                    acc += cover;
+
+                    if (alpha) {
+                        if (open && open->x1 == x) {
+                            ++open->x1;
+                        } else {
+                            mask.runs.push_back(CoverageMask::Run{
+                                y, x, x + 1, static_cast<int32_t>(mask.alphas.size()), 0});
+                            open = &mask.runs.back();
+                        }
+                        mask.alphas.push_back(alpha);
+                    } else {
+                        open = nullptr;
+                    }
+
+                    // Interior sampai cell berikutnya di baris ini
+                    int next = (i < cells_.size() && cells_[i].y == y) ? cells_[i].x : x + 1;
+                    uint8_t fill = to_alpha(acc, rule);
+                    if (next > x + 1 && fill) {
+                        mask.runs.push_back(CoverageMask::Run{y, x + 1, next, -1, fill});
+                        open = nullptr;
+                    }
+                }
+            }
+        }
+
+        size_t cell_count() const noexcept { return cells_.size(); }
+    };
+
+    // Cache geometri: path + fill rule / stroke + transform -> CoverageMask.
+    // Translasi dipisah jadi bagian integer (offset blit) dan pecahan (ikut
+    // key), jadi ikon yang sama di posisi integer berbeda memakai satu mask.
+    class GeometryCache {
+    public:
+        struct Entry {
+            CoverageMask mask;
+        };
+
+    private:
+        using Lru = std::list<std::pair<uint64_t, Entry>>;
+
+        Lru lru_;
+        std::unordered_map<uint64_t, Lru::iterator> index_;
+        size_t byte_budget_{4u << 20};
+        size_t bytes_{0};
+        uint64_t hits_{0};
+        uint64_t misses_{0};
+
+        void evict() {
+            while (bytes_ > byte_budget_ && lru_.size() > 1) {
+                auto& victim = lru_.back();
+                bytes_ -= victim.second.mask.byte_size();
+                index_.erase(victim.first);
+                lru_.pop_back();
+            }
+        }
+
+    public:
+        // Key: hash path, mode (fill rule / stroke style) dan transform dengan
+        // translasi pecahan saja
+        static uint64_t key(uint64_t path_hash, const Transform& fractional, FillRule rule,
+                            const StrokeStyle* stroke) noexcept {
+            detail::StateHasher hasher;
+            hasher.add(path_hash).add(fractional).add(rule).add(stroke != nullptr);
+            if (stroke) {
+                hasher.add(stroke->width).add(stroke->cap).add(stroke->join).add(stroke->miter_limit);
+            }
+            return hasher.value();
+        }
+
+        // Mask untuk key; build(mask) hanya dipanggil saat miss
+        template <typename Build>
+        const CoverageMask& get(uint64_t key, Build&& build) {
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                ++hits_;
+                lru_.splice(lru_.begin(), lru_, it->second);
+                return it->second->second.mask;
+            }
+
+            ++misses_;
+            lru_.emplace_front(key, Entry{});
+            index_[key] = lru_.begin();
+            CoverageMask& mask = lru_.front().second.mask;
+            build(mask);
+            bytes_ += mask.byte_size();
+            evict();
+            return lru_.front().second.mask;
+        }
+
+        void set_byte_budget(size_t bytes) {
+            byte_budget_ = bytes;
+            evict();
+        }
+
+        void clear() noexcept {
+            lru_.clear();
+            index_.clear();
+            bytes_ = 0;
+        }
+
+        size_t size() const noexcept { return lru_.size(); }
+        size_t byte_size() const noexcept { return bytes_; }
+        uint64_t hits() const noexcept { return hits_; }
+        uint64_t misses() const noexcept { return misses_; }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,442 @@
+#pragma once
+
+#include "zwidget/unit/rect.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Region integer dengan representasi y-x banded (seperti pixman/X11):
+    // box disimpan per band horizontal (y1, y2 sama), band terurut naik,
+    // box dalam satu band terurut berdasarkan x dan tidak saling overlap.
+    // Band bersebelahan dengan span identik selalu digabung, jadi representasi
+    // untuk satu himpunan piksel selalu unik.
+    class Region {
+    public:
+        struct Box {
+            int x1, y1, x2, y2;
+
+            constexpr int64_t area() const noexcept {
+                return static_cast<int64_t>(x2 - x1) * (y2 - y1);
+            }
+
+            constexpr basic_rect<int> to_rect() const noexcept {
+                return basic_rect<int>(x1, y1, x2 - x1, y2 - y1);
+            }
+
+            constexpr bool operator==(const Box&) const noexcept = default;
+        };
+
+    private:
+        std::vector<Box> boxes_;
+        Box extents_{0, 0, 0, 0};
+
+        enum class Op : uint8_t { Union, Intersect, Subtract };
+
+        struct Span {
+            int x1, x2;
+            constexpr bool operator==(const Span&) const noexcept = default;
+        };
+
+        // Kombinasi dua daftar span terurut (tidak overlap) dalam satu band
+        static void combine_spans(
+            const std::vector<Span>& a,
+            const std::vector<Span>& b,
+            Op op,
+            std::vector<Span>& out
+        ) {
+            out.clear();
+            size_t i = 0, j = 0;
+
+            switch (op) {
+                case Op::Union: {
+                    auto append = [&out](Span s) {
+                        if (!out.empty() && s.x1 <= out.back().x2) {
+                            out.back().x2 = std::max(out.back().x2, s.x2);
+                        } else {
+                            out.push_back(s);
+                        }
+                    };
+                    while (i < a.size() || j < b.size()) {
+                        if (j >= b.size() || (i < a.size() && a[i].x1 <= b[j].x1)) {
+                            append(a[i++]);
+                        } else {
+                            append(b[j++]);
+                        }
+                    }
+                    break;
+                }
+
+                case Op::Intersect: {
+                    while (i < a.size() && j < b.size()) {
+                        int x1 = std::max(a[i].x1, b[j].x1);
+                        int x2 = std::min(a[i].x2, b[j].x2);
+                        if (x1 < x2) {
+                            out.push_back({x1, x2});
+                        }
+                        if (a[i].x2 < b[j].x2) ++i; else ++j;
+                    }
+                    break;
+                }
+
+                case Op::Subtract: {
+                    for (; i < a.size(); ++i) {
+                        int x1 = a[i].x1;
+                        int x2 = a[i].x2;
+                        while (j < b.size() && b[j].x2 <= x1) ++j;
+
+                        size_t k = j;
+                        while (k < b.size() && b[k].x1 < x2) {
+                            if (b[k].x1 > x1) {
+                                out.push_back({x1, b[k].x1});
+                            }
+                            x1 = std::max(x1, b[k].x2);
+                            if (x1 >= x2) break;
+                            ++k;
+                        }
+                        if (x1 < x2) {
+                            out.push_back({x1, x2});
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        // Ambil span dari band yang menutupi baris y (kosong kalau tidak ada).
+        // `pos` hanya maju, karena y yang diminta selalu naik.
+        static void spans_at(
+            const std::vector<Box>& boxes,
+            size_t& pos,
+            int y,
+            std::vector<Span>& out
+        ) {
+            out.clear();
+            while (pos < boxes.size() && boxes[pos].y2 <= y) ++pos;
+            if (pos >= boxes.size() || boxes[pos].y1 > y) return;
+
+            int band_y1 = boxes[pos].y1;
+            for (size_t k = pos; k < boxes.size() && boxes[k].y1 == band_y1; ++k) {
+                out.push_back({boxes[k].x1, boxes[k].x2});
+            }
+        }
+
+        // Menyusun hasil band per band sambil menggabungkan band bersebelahan
+        // yang span-nya identik
+        class BandBuilder {
+        private:
+            std::vector<Box>& boxes_;
+            std::vector<Span> prev_;
+            size_t prev_start_{0};
+            int prev_y2_{0};
+            bool has_prev_{false};
+
+        public:
+            explicit BandBuilder(std::vector<Box>& boxes) : boxes_(boxes) {}
+
+            void add(int y1, int y2, const std::vector<Span>& spans) {
+                if (spans.empty()) {
+                    has_prev_ = false;
+                    return;
+                }
+
+                if (has_prev_ && prev_y2_ == y1 && spans == prev_) {
+                    for (size_t k = prev_start_; k < boxes_.size(); ++k) {
+                        boxes_[k].y2 = y2;
+                    }
+                } else {
+                    prev_start_ = boxes_.size();
+                    for (const auto& s : spans) {
+                        boxes_.push_back({s.x1, y1, s.x2, y2});
+                    }
+                    prev_ = spans;
+                    has_prev_ = true;
+                }
+                prev_y2_ = y2;
+            }
+        };
+
+        static Region apply(const Region& a, const Region& b, Op op) {
+            // Fast path untuk kasus yang sering terjadi
+            switch (op) {
+                case Op::Union:
+                    if (a.is_empty()) return b;
+                    if (b.is_empty()) return a;
+                    break;
+                case Op::Intersect:
+                    if (a.is_empty() || b.is_empty() || !overlaps(a.extents_, b.extents_)) return {};
+                    break;
+                case Op::Subtract:
+                    if (a.is_empty() || b.is_empty() || !overlaps(a.extents_, b.extents_)) return a;
+                    break;
+            }
+
+            // Semua batas y dari kedua region membentuk band hasil
+            std::vector<int> ys;
+            ys.reserve((a.boxes_.size() + b.boxes_.size()) * 2);
+            for (const auto& box : a.boxes_) { ys.push_back(box.y1); ys.push_back(box.y2); }
+            for (const auto& box : b.boxes_) { ys.push_back(box.y1); ys.push_back(box.y2); }
+            std::sort(ys.begin(), ys.end());
+            ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+            Region result;
+            result.boxes_.reserve(a.boxes_.size() + b.boxes_.size());
+            BandBuilder builder(result.boxes_);
+
+            std::vector<Span> sa, sb, out;
+            size_t pa = 0, pb = 0;
+
+            for (size_t n = 0; n + 1 < ys.size(); ++n) {
+                spans_at(a.boxes_, pa, ys[n], sa);
+                spans_at(b.boxes_, pb, ys[n], sb);
+                combine_spans(sa, sb, op, out);
+                builder.add(ys[n], ys[n + 1], out);
+            }
+
+            result.update_extents();
+            return result;
+        }
+
+        static constexpr bool overlaps(const Box& a, const Box& b) noexcept {
+            return a.x1 < b.x2 && b.x1 < a.x2 && a.y1 < b.y2 && b.y1 < a.y2;
+        }
+
+        void update_extents() noexcept {
+            if (boxes_.empty()) {
+                extents_ = {0, 0, 0, 0};
+                return;
+            }
+            extents_ = {boxes_.front().x1, boxes_.front().y1, boxes_.front().x2, boxes_.back().y2};
+            for (const auto& box : boxes_) {
+                extents_.x1 = std::min(extents_.x1, box.x1);
+                extents_.x2 = std::max(extents_.x2, box.x2);
+            }
+        }
+
+    public:
+        Region() = default;
+
+        explicit Region(const basic_rect<int>& rect) {
+            if (rect.w > 0 && rect.h > 0) {
+                boxes_.push_back({rect.x, rect.y, rect.x + rect.w, rect.y + rect.h});
+                extents_ = boxes_.front();
+            }
+        }
+
+        // Bangun region dari banyak rect sekaligus dengan satu sweep vertikal,
+        // jauh lebih murah daripada unite() satu per satu
+        static Region from_rects(const std::vector<basic_rect<int>>& rects) {
+            std::vector<Box> input;
+            input.reserve(rects.size());
+            for (const auto& rect : rects) {
+                if (rect.w > 0 && rect.h > 0) {
+                    input.push_back({rect.x, rect.y, rect.x + rect.w, rect.y + rect.h});
+                }
+            }
+            if (input.empty()) return {};
+
+            std::sort(input.begin(), input.end(), [](const Box& a, const Box& b) {
+                return a.y1 < b.y1;
+            });
+
+            std::vector<int> ys;
+            ys.reserve(input.size() * 2);
+            for (const auto& box : input) { ys.push_back(box.y1); ys.push_back(box.y2); }
+            std::sort(ys.begin(), ys.end());
+            ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+            Region result;
+            BandBuilder builder(result.boxes_);
+
+            std::vector<const Box*> active;
+            std::vector<Span> spans;
+            size_t next = 0;
+
+            for (size_t n = 0; n + 1 < ys.size(); ++n) {
+                int y1 = ys[n];
+                int y2 = ys[n + 1];
+
+                std::erase_if(active, [y1](const Box* box) { return box->y2 <= y1; });
+                while (next < input.size() && input[next].y1 <= y1) {
+                    active.push_back(&input[next++]);
+                }
+
+                spans.clear();
+                for (const Box* box : active) {
+                    spans.push_back({box->x1, box->x2});
+                }
+                std::sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) {
+                    return a.x1 < b.x1;
+                });
+
+                // Gabung span yang overlap/bersentuhan
+                size_t out = 0;
+                for (size_t k = 0; k < spans.size(); ++k) {
+                    if (out > 0 && spans[k].x1 <= spans[out - 1].x2) {
+                        spans[out - 1].x2 = std::max(spans[out - 1].x2, spans[k].x2);
+                    } else {
+                        spans[out++] = spans[k];
+                    }
+                }
+                spans.resize(out);
+
+                builder.add(y1, y2, spans);
+            }
+
+            result.update_extents();
+            return result;
+        }
+
+        // Set operations
+        Region& unite(const Region& other) {
+            return *this = apply(*this, other, Op::Union);
+        }
+
+        Region& unite(const basic_rect<int>& rect) {
+            if (rect.w <= 0 || rect.h <= 0) return *this;
+
+            Box box{rect.x, rect.y, rect.x + rect.w, rect.y + rect.h};
+            if (contains(box)) return *this;
+
+            return unite(Region(rect));
+        }
+
+        Region& intersect(const Region& other) {
+            return *this = apply(*this, other, Op::Intersect);
+        }
+
+        Region& intersect(const basic_rect<int>& rect) {
+            // Clip ke rect yang sudah menutupi seluruh region (kasus umum: bounds surface)
+            if (rect.x <= extents_.x1 && rect.y <= extents_.y1 &&
+                rect.x + rect.w >= extents_.x2 && rect.y + rect.h >= extents_.y2 &&
+                rect.w > 0 && rect.h > 0) {
+                return *this;
+            }
+            return intersect(Region(rect));
+        }
+
+        Region& subtract(const Region& other) {
+            return *this = apply(*this, other, Op::Subtract);
+        }
+
+        Region& subtract(const basic_rect<int>& rect) {
+            return subtract(Region(rect));
+        }
+
+        Region& operator|=(const Region& other) { return unite(other); }
+        Region& operator&=(const Region& other) { return intersect(other); }
+        Region& operator-=(const Region& other) { return subtract(other); }
+
+        friend Region operator|(const Region& a, const Region& b) { return apply(a, b, Op::Union); }
+        friend Region operator&(const Region& a, const Region& b) { return apply(a, b, Op::Intersect); }
+        friend Region operator-(const Region& a, const Region& b) { return apply(a, b, Op::Subtract); }
+
+        bool operator==(const Region& other) const noexcept {
+            return boxes_ == other.boxes_;
+        }
+
+        void translate(int dx, int dy) noexcept {
+            for (auto& box : boxes_) {
+                box.x1 += dx; box.x2 += dx;
+                box.y1 += dy; box.y2 += dy;
+            }
+            if (!boxes_.empty()) {
+                extents_.x1 += dx; extents_.x2 += dx;
+                extents_.y1 += dy; extents_.y2 += dy;
+            }
+        }
+
+        void clear() noexcept {
+            boxes_.clear();
+            extents_ = {0, 0, 0, 0};
+        }
+
+        // Queries
+        bool is_empty() const noexcept {
+            return boxes_.empty();
+        }
+
+        bool is_rect() const noexcept {
+            return boxes_.size() == 1;
+        }
+
+        size_t box_count() const noexcept {
+            return boxes_.size();
+        }
+
+        const std::vector<Box>& boxes() const noexcept {
+            return boxes_;
+        }
+
+        const Box& extents() const noexcept {
+            return extents_;
+        }
+
+        basic_rect<int> bounds() const noexcept {
+            return extents_.to_rect();
+        }
+
+        int64_t area() const noexcept {
+            int64_t total = 0;
+            for (const auto& box : boxes_) {
+                total += box.area();
+            }
+            return total;
+        }
+
+        std::vector<basic_rect<int>> rects() const {
+            std::vector<basic_rect<int>> out;
+            out.reserve(boxes_.size());
+            for (const auto& box : boxes_) {
+                out.push_back(box.to_rect());
+            }
+            return out;
+        }
+
+        bool contains(int x, int y) const noexcept {
+            if (x < extents_.x1 || x >= extents_.x2 || y < extents_.y1 || y >= extents_.y2) {
+                return false;
+            }
+            for (const auto& box : boxes_) {
+                if (box.y1 > y) break;
+                if (y < box.y2 && x >= box.x1 && x < box.x2) return true;
+            }
+            return false;
+        }
+
+        // true kalau box sepenuhnya tertutup region
+        bool contains(const Box& box) const {
+            if (box.x1 >= box.x2 || box.y1 >= box.y2) return true;
+            if (box.x1 < extents_.x1 || box.x2 > extents_.x2 ||
+                box.y1 < extents_.y1 || box.y2 > extents_.y2) {
+                return false;
+            }
+
+            // Setiap band yang memotong box harus menutup [x1, x2) dengan satu box,
+            // dan band-band tersebut harus kontinu secara vertikal
+            int covered_to = box.y1;
+            for (const auto& b : boxes_) {
+                if (b.y2 <= covered_to) continue;
+                if (b.y1 > covered_to) return false;
+                if (b.x1 <= box.x1 && b.x2 >= box.x2) {
+                    covered_to = b.y2;
+                    if (covered_to >= box.y2) return true;
+                }
+            }
+            return false;
+        }
+
+        bool intersects(const basic_rect<int>& rect) const noexcept {
+            if (rect.w <= 0 || rect.h <= 0 || boxes_.empty()) return false;
+            Box r{rect.x, rect.y, rect.x + rect.w, rect.y + rect.h};
+            if (!overlaps(r, extents_)) return false;
+            for (const auto& box : boxes_) {
+                if (box.y1 >= r.y2) break;
+                if (overlaps(box, r)) return true;
+            }
+            return false;
+        }
+    };
+
+} // namespace zuu::widget
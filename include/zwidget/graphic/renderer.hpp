@@ -1,6 +1,15 @@
 #pragma once
 
-#include "canvas.hpp"
+#include "zwidget/detail/platform.hpp"
+
+#if ZWIDGET_PLATFORM_HEADLESS
+    #include "zwidget/platform/headless/renderer.hpp"
+#else
+
+#include "d2d_canvas.hpp"
+#include "batching_canvas.hpp"
+#include "dirty_region_tracker.hpp"
+#include "layer_cache.hpp"
 #include "zwidget/unit/rect.hpp"
 #include <d2d1.h>
 #include <dwrite.h>
@@ -15,78 +24,11 @@
 
 namespace zuu::widget {
 
-    // Dirty region tracker untuk partial redraw
-    class DirtyRegionTracker {
-    private:
-        std::vector<basic_rect<int>> dirty_regions_;
-        bool is_full_dirty_{false};
-
-    public:
-        void mark_dirty(const basic_rect<int>& region) {
-            if (is_full_dirty_) return;
-			if (region.w <= 0 || region.h <= 0) return;
-
-            // Merge overlapping regions untuk optimisasi
-            bool merged = false;
-            for (auto& existing : dirty_regions_) {
-                if (regions_overlap(existing, region)) {
-                    existing = merge_regions(existing, region);
-                    merged = true;
-                    break;
-                }
-            }
-
-            if (!merged) {
-                dirty_regions_.push_back(region);
-            }
-
-            // Jika terlalu banyak region, mark sebagai full dirty
-            if (dirty_regions_.size() > 10) {
-                is_full_dirty_ = true;
-                dirty_regions_.clear();
-            }
-        }
-
-        void mark_full_dirty() {
-            is_full_dirty_ = true;
-            dirty_regions_.clear();
-        }
-
-        void clear() {
-            dirty_regions_.clear();
-            is_full_dirty_ = false;
-        }
-
-        bool is_dirty() const noexcept {
-            return is_full_dirty_ || !dirty_regions_.empty();
-        }
-
-        bool is_full_dirty() const noexcept {
-            return is_full_dirty_;
-        }
-
-        const std::vector<basic_rect<int>>& get_regions() const noexcept {
-            return dirty_regions_;
-        }
-
-    private:
-        static bool regions_overlap(const basic_rect<int>& a, const basic_rect<int>& b) {
-            return !(a.x + a.w < b.x || b.x + b.w < a.x ||
-                     a.y + a.h < b.y || b.y + b.h < a.y);
-        }
-
-        static basic_rect<int> merge_regions(const basic_rect<int>& a, const basic_rect<int>& b) {
-            int x1 = (a.x < b.x) ? a.x : b.x;
-            int y1 = (a.y < b.y) ? a.y : b.y;
-            int x2 = ((a.x + a.w) > (b.x + b.w)) ? (a.x + a.w) : (b.x + b.w);
-            int y2 = ((a.y + a.h) > (b.y + b.h)) ? (a.y + a.h) : (b.y + b.h);
-            return basic_rect<int>(x1, y1, x2 - x1, y2 - y1);
-        }
-    };
-
     // Renderer class - mengelola Direct2D resources
-    class Renderer : public Canvas {
+    class Renderer : public BatchingCanvas<D2DCanvas> {
     private:
+        using Base = BatchingCanvas<D2DCanvas>;
+
         static inline Microsoft::WRL::ComPtr<ID2D1Factory> d2d_factory_;
         static inline Microsoft::WRL::ComPtr<IDWriteFactory> dwrite_factory_;
         static inline bool factories_initialized_{false};
@@ -94,10 +36,30 @@ namespace zuu::widget {
         Microsoft::WRL::ComPtr<ID2D1HwndRenderTarget> hwnd_render_target_;
         Microsoft::WRL::ComPtr<IDWriteTextFormat> default_text_format_;
         
+        struct PendingScroll {
+            basic_rect<int> area;
+            int dx, dy;
+        };
+
         HWND hwnd_{nullptr};
         DirtyRegionTracker dirty_tracker_;
+        std::vector<PendingScroll> scrolls_;
         bool in_draw_{false};
 
+        // Blit sebelum clip damage di-push (D2D menolak copy saat ada clip).
+        // Saat full repaint blit percuma; kalau backend gagal, area di-repaint.
+        void apply_scrolls() {
+            if (scrolls_.empty()) return;
+
+            bool full = dirty_tracker_.is_full_dirty();
+            for (const auto& s : scrolls_) {
+                if (!full && !scroll_rect(s.area, s.dx, s.dy)) {
+                    dirty_tracker_.mark_dirty(s.area);
+                }
+            }
+            scrolls_.clear();
+        }
+
     public:
         Renderer() = default;
 
@@ -109,21 +71,23 @@ namespace zuu::widget {
         Renderer& operator=(const Renderer&) = delete;
 
         Renderer(Renderer&& other) noexcept
-            : Canvas(std::move(other))
+            : Base(std::move(other))
             , hwnd_render_target_(std::move(other.hwnd_render_target_))
             , default_text_format_(std::move(other.default_text_format_))
             , hwnd_(std::exchange(other.hwnd_, nullptr))
             , dirty_tracker_(std::move(other.dirty_tracker_))
+            , scrolls_(std::move(other.scrolls_))
             , in_draw_(other.in_draw_) {}
 
         Renderer& operator=(Renderer&& other) noexcept {
             if (this != &other) {
                 cleanup();
-                Canvas::operator=(std::move(other));
+                Base::operator=(std::move(other));
                 hwnd_render_target_ = std::move(other.hwnd_render_target_);
                 default_text_format_ = std::move(other.default_text_format_);
                 hwnd_ = std::exchange(other.hwnd_, nullptr);
                 dirty_tracker_ = std::move(other.dirty_tracker_);
+                scrolls_ = std::move(other.scrolls_);
                 in_draw_ = other.in_draw_;
             }
             return *this;
@@ -207,7 +171,11 @@ namespace zuu::widget {
             );
 
             if (FAILED(hr)) return false;
+            fallback_text_format_ = default_text_format_.Get();  // Untuk canvas layer
 
+            // Clip damage = layer geometry group, satu geometry per rect
+            dirty_tracker_.set_max_regions(32);
+            dirty_tracker_.set_bounds(basic_rect<int>(0, 0, size.w, size.h));
             dirty_tracker_.mark_full_dirty();
             return true;
         }
@@ -216,6 +184,7 @@ namespace zuu::widget {
         void resize(const basic_size<int>& new_size) {
             if (hwnd_render_target_) {
                 hwnd_render_target_->Resize(D2D1::SizeU(new_size.w, new_size.h));
+                dirty_tracker_.set_bounds(basic_rect<int>(0, 0, new_size.w, new_size.h));
                 dirty_tracker_.mark_full_dirty();
             }
         }
@@ -236,6 +205,19 @@ namespace zuu::widget {
             }
         }
 
+        // Scroll: konten area digeser (dx, dy) dengan blit di awal frame
+        // berikutnya, jadi yang di-repaint hanya strip yang terbuka (plus
+        // damage lama yang ikut bergeser)
+        void scroll(const basic_rect<int>& area, int dx, int dy) {
+            if (area.w <= 0 || area.h <= 0 || (dx == 0 && dy == 0)) return;
+            scrolls_.push_back(PendingScroll{area, dx, dy});
+            dirty_tracker_.scroll(area, dx, dy);
+            if (hwnd_) {
+                RECT rect = { area.x, area.y, area.x + area.w, area.y + area.h };
+                InvalidateRect(hwnd_, &rect, FALSE);
+            }
+        }
+
         bool needs_redraw() const noexcept {
             return dirty_tracker_.is_dirty();
         }
@@ -281,23 +263,28 @@ namespace zuu::widget {
 
 			if (!begin_draw()) return false;
 
+			apply_scrolls();
+			frame_stats_.reset();
+			set_batching(true);
+
+			// Satu traversal: widget di luar damage di-cull oleh Container,
+			// sisanya di-clip sekali ke gabungan region
 			if (dirty_tracker_.is_full_dirty()) {
+				set_damage(nullptr);
 				draw_func(*this);
 			} else {
-				for (const auto& region : dirty_tracker_.get_regions()) {
-					push_clip(basic_rect<float>(
-						static_cast<float>(region.x),
-						static_cast<float>(region.y),
-						static_cast<float>(region.w),
-						static_cast<float>(region.h)
-					));
-					
-					draw_func(*this);
-					
-					pop_clip();
-				}
+				const Region& damage = dirty_tracker_.get_paint_region();
+				set_damage(&damage);
+				push_clip_region(damage);
+
+				draw_func(*this);
+
+				pop_clip();
+				set_damage(nullptr);
 			}
 
+			set_batching(false);
+
 			bool success = end_draw();
 			
 			// If device was lost, try to recreate
@@ -342,13 +329,49 @@ namespace zuu::widget {
             return SUCCEEDED(hr) ? format : nullptr;
         }
 
-        // Override draw_text untuk menggunakan default text format
+        // Override draw_text / draw_cached_text / cached_text_bounds / measure_text untuk menggunakan default text format
         void draw_text(
             const std::wstring& text,
             const basic_rect<float>& rect,
-            const Color& color
-        ) {
-            Canvas::draw_text(text, rect, color, default_text_format_.Get());
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            Base::draw_text(
+                text,
+                rect,
+                color,
+                text_format ? text_format : default_text_format_.Get()
+            );
+        }
+
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            Base::draw_cached_text(
+                text,
+                rect,
+                color,
+                text_format ? text_format : default_text_format_.Get()
+            );
+        }
+
+        basic_rect<float> cached_text_bounds(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            TextFormat* text_format = nullptr
+        ) override {
+            return Base::cached_text_bounds(text, rect, text_format ? text_format : default_text_format_.Get());
+        }
+
+        TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) override {
+            return Base::measure_text(text, text_format ? text_format : default_text_format_.Get(), advances);
         }
 
         // Getters
@@ -366,6 +389,9 @@ namespace zuu::widget {
 
     private:
         void cleanup_device_resources() {
+            // Layer adalah resource milik render target ini; layer window lain tetap
+            if (render_target_) LayerCache::global().release_device(layer_device());
+            scroll_bitmap_.Reset();
             brush_.Reset();
             render_target_.Reset();
             hwnd_render_target_.Reset();
@@ -374,9 +400,12 @@ namespace zuu::widget {
         void cleanup() {
             cleanup_device_resources();
             default_text_format_.Reset();
+            fallback_text_format_ = nullptr;
             hwnd_ = nullptr;
             in_draw_ = false;
         }
     };
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
+
+#endif // ZWIDGET_PLATFORM_HEADLESS
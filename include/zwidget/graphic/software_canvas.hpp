@@ -0,0 +1,1200 @@
+#pragma once
+
+#include "analytic_coverage.hpp"
+#include "canvas.hpp"
+#include "font.hpp"
+#include "glyph_atlas.hpp"
+#include "path_rasterizer.hpp"
+#include "span_kernels.hpp"
+#include "srgb.hpp"
+#include "text_layout.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace zuu::widget {
+
+    // SoftwareCanvas - rasterizer CPU ke framebuffer BGRA8 premultiplied milik
+    // sendiri. Tidak butuh header Windows, jadi bisa dipakai headless (CI,
+    // benchmark, regression test berbasis pixel). Lewat attach_tile() canvas
+    // juga bisa jadi view satu tile framebuffer canvas lain (render paralel).
+    class SoftwareCanvas : public Canvas {
+    public:
+        static constexpr PixelFormat pixel_format = PixelFormat::Bgra8;
+
+    private:
+        std::vector<uint32_t> pixels_;
+        uint32_t* surface_{nullptr};                // pixels_, atau framebuffer canvas lain
+        int width_{0};
+        int height_{0};
+        int stride_{0};                             // in pixels
+        basic_point<int> origin_{0, 0};             // Koordinat canvas pixel (0, 0) surface
+
+        // Transform: translasi integer cukup menggeser koordinat user (origin,
+        // clip) tanpa math per primitive; selain itu (pecahan, skala, rotasi)
+        // primitive dijadikan path dan di-raster dengan transform penuh.
+        // Disimpan terpisah dari Canvas::transform_ karena BatchingCanvas
+        // bisa menahan backend di transform lain saat flush.
+        basic_point<int> shift_{0, 0};              // Translasi integer aktif
+        basic_point<int> user_origin_{0, 0};        // origin_ - shift_: koordinat user pixel (0, 0)
+        Transform raster_transform_;                // Transform penuh, dipakai saat affine_
+        bool affine_{false};
+        Path shape_;                                // Scratch path jalur affine
+        TextLayout text_layout_;                    // Scratch layout draw_text (tanpa cache)
+
+        struct ClipEntry {
+            basic_rect<int> rect;
+            bool region;                            // Entry dari push_clip_region
+        };
+
+        struct SavedRegion {
+            Region region;
+            bool active;
+        };
+
+        basic_rect<int> clip_{0, 0, 0, 0};          // Intersection of the clip stack
+        std::vector<ClipEntry> clip_stack_;
+        Region clip_region_;                        // Region clip, di dalam clip_
+        bool has_clip_region_{false};
+        std::vector<SavedRegion> region_stack_;
+        std::vector<uint8_t> coverage_;             // Scratch row for AA shapes
+        SpanKernels kernels_{span_kernels<pixel_format>()};
+        BlendMode blend_mode_{BlendMode::Srgb};
+
+        // Path: mask coverage di-cache per path + transform
+        GeometryCache geometry_cache_;
+        PathRasterizer path_rasterizer_;
+        std::vector<Contour> contours_;
+        std::vector<Contour> stroked_;
+
+    public:
+        SoftwareCanvas() = default;
+
+        explicit SoftwareCanvas(const basic_size<int>& size) {
+            resize(size);
+        }
+
+        SoftwareCanvas(SoftwareCanvas&&) = default;
+        SoftwareCanvas& operator=(SoftwareCanvas&&) = default;
+
+        // Reallocates the framebuffer; contents are reset to transparent
+        void resize(const basic_size<int>& size) {
+            width_ = std::max(size.w, 0);
+            height_ = std::max(size.h, 0);
+            pixels_.assign(static_cast<size_t>(width_) * height_, 0u);
+            surface_ = pixels_.data();
+            stride_ = width_;
+            coverage_.assign(static_cast<size_t>(width_), 0);
+            set_origin(basic_point<int>(0, 0));
+        }
+
+        // Surface menutupi rect [origin, origin + size) di koordinat canvas;
+        // dipakai layer offscreen supaya subtree tetap digambar dengan
+        // koordinat absolutnya. Clip di-reset ke seluruh surface.
+        void set_origin(const basic_point<int>& origin) {
+            origin_ = origin;
+            user_origin_ = origin;
+            shift_ = basic_point<int>(0, 0);
+            transform_ = raster_transform_ = Transform::identity();
+            affine_ = false;
+            state_stack_.clear();
+            clip_bounds_.clear();
+            clip_stack_.clear();
+            region_stack_.clear();
+            clip_region_.clear();
+            has_clip_region_ = false;
+            clip_ = basic_rect<int>(origin_.x, origin_.y, width_, height_);
+        }
+
+        // Jadikan canvas ini view ke framebuffer parent, di-clip ke tile
+        // (dan clip parent saat ini, termasuk region). Hanya pixel di dalam
+        // tile yang disentuh, jadi view untuk tile berbeda aman dipakai
+        // paralel. Framebuffer sendiri tidak dialokasi.
+        void attach_tile(const SoftwareCanvas& parent, const basic_rect<int>& tile) {
+            pixels_.clear();
+            surface_ = parent.surface_;
+            width_ = parent.width_;
+            height_ = parent.height_;
+            stride_ = parent.stride_;
+            origin_ = parent.origin_;
+            shift_ = parent.shift_;
+            user_origin_ = parent.user_origin_;
+            transform_ = parent.transform_;
+            raster_transform_ = parent.raster_transform_;
+            affine_ = parent.affine_;
+            if (coverage_.size() < static_cast<size_t>(width_)) {
+                coverage_.assign(static_cast<size_t>(width_), 0);
+            }
+            kernels_ = parent.kernels_;
+            blend_mode_ = parent.blend_mode_;
+
+            clip_bounds_.clear();
+            clip_stack_.clear();
+            region_stack_.clear();
+            clip_ = intersect(parent.clip_, tile.x, tile.y, tile.x + tile.w, tile.y + tile.h);
+            has_clip_region_ = parent.has_clip_region_;
+            if (has_clip_region_) {
+                clip_region_ = parent.clip_region_;
+            }
+        }
+
+        // Basic drawing operations
+        void clear(ColorU8 color) override {
+            uint32_t src = pack(color);
+
+            // Clip selebar surface: baris kontigu, satu fill besar
+            if (!has_clip_region_ && clip_.x == user_origin_.x && clip_.w == width_ && stride_ == width_) {
+                kernels_.fill(pixel_ptr(clip_.x, clip_.y), static_cast<size_t>(clip_.w) * clip_.h, src);
+                return;
+            }
+
+            for (int y = clip_.y; y < clip_.y + clip_.h; ++y) {
+                for_each_clip_span(y, clip_.x, clip_.x + clip_.w, [&](int x0, int x1) {
+                    kernels_.fill(pixel_ptr(x0, y), static_cast<size_t>(x1 - x0), src);
+                });
+            }
+        }
+
+        void draw_line(
+            const basic_point<float>& start,
+            const basic_point<float>& end,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || width <= 0.0f) return;
+            if (culled(stroke_bounds(start.x, start.y, end.x, end.y, width))) return;
+            if (affine_) {
+                shape_.clear();
+                shape_.move_to(start.x, start.y).line_to(end.x, end.y);
+                return stroke_shape(src, width);
+            }
+            stroke_line(start, end, src, width);
+        }
+
+        // Batch: warna di-pack ulang hanya saat berganti
+        void draw_lines(std::span<const LineSeg> lines) override {
+            if (affine_) return Canvas::draw_lines(lines);
+            for (const auto& l : lines) {
+                uint32_t src = pack(l.color);
+                if (src == 0 || l.width <= 0.0f) continue;
+                if (culled(stroke_bounds(l.start.x, l.start.y, l.end.x, l.end.y, l.width))) continue;
+                stroke_line(l.start, l.end, src, l.width);
+            }
+        }
+
+        void draw_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || width <= 0.0f || culled(rect_bounds(rect, width))) return;
+            if (affine_) {
+                shape_.clear();
+                append_rounded(rect, 0.0f, 0.0f);
+                return stroke_shape(src, width);
+            }
+            stroke_rect(rect, src, width);
+        }
+
+        void draw_rects(std::span<const basic_rect<float>> rects, ColorU8 color, float width = 1.0f) override {
+            if (affine_) return Canvas::draw_rects(rects, color, width);
+            uint32_t src = pack(color);
+            if (src == 0 || width <= 0.0f) return;
+            for (const auto& rect : rects) {
+                if (culled(rect_bounds(rect, width))) continue;
+                stroke_rect(rect, src, width);
+            }
+        }
+
+        void fill_rect(
+            const basic_rect<float>& rect,
+            ColorU8 color
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || culled(rect_bounds(rect, 0.0f))) return;
+            if (affine_) {
+                shape_.clear();
+                append_rounded(rect, 0.0f, 0.0f);
+                return fill_shape(src);
+            }
+            fill_area(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, src);
+        }
+
+        void fill_rects(std::span<const basic_rect<float>> rects, ColorU8 color) override {
+            if (affine_) return Canvas::fill_rects(rects, color);
+            uint32_t src = pack(color);
+            if (src == 0) return;
+            for (const auto& rect : rects) {
+                if (culled(rect_bounds(rect, 0.0f))) continue;
+                fill_area(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, src);
+            }
+        }
+
+        void fill_rects(std::span<const RectColor> rects) override {
+            if (affine_) return Canvas::fill_rects(rects);
+            for (const auto& r : rects) {
+                uint32_t src = pack(r.color);
+                if (src == 0 || culled(rect_bounds(r.rect, 0.0f))) continue;
+                fill_area(r.rect.x, r.rect.y, r.rect.x + r.rect.w, r.rect.y + r.rect.h, src);
+            }
+        }
+
+        void draw_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || width <= 0.0f || culled(rect_bounds(rect, width))) return;
+            if (affine_) {
+                shape_.clear();
+                append_rounded(rect, radius_x, radius_y);
+                return stroke_shape(src, width);
+            }
+
+            // Ring = outer (offset keluar) - inner (offset ke dalam)
+            double h = width * 0.5;
+            bool rounded = radius_x > 0.0f && radius_y > 0.0f;
+            auto outer = detail::RoundedBox::make(
+                rect.x - h, rect.y - h, rect.x + rect.w + h, rect.y + rect.h + h,
+                rounded ? radius_x + h : 0.0, rounded ? radius_y + h : 0.0);
+            auto inner = detail::RoundedBox::make(
+                rect.x + h, rect.y + h, rect.x + rect.w - h, rect.y + rect.h - h,
+                radius_x - h, radius_y - h);
+            fill_rounded_box(outer, inner, src);
+        }
+
+        void fill_rounded_rect(
+            const basic_rect<float>& rect,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || culled(rect_bounds(rect, 0.0f))) return;
+            if (affine_) {
+                shape_.clear();
+                append_rounded(rect, radius_x, radius_y);
+                return fill_shape(src);
+            }
+            fill_rounded(rect, radius_x, radius_y, src);
+        }
+
+        void fill_rounded_rects(std::span<const RoundedRectColor> rects) override {
+            if (affine_) return Canvas::fill_rounded_rects(rects);
+            for (const auto& r : rects) {
+                uint32_t src = pack(r.color);
+                if (src == 0 || culled(rect_bounds(r.rect, 0.0f))) continue;
+                fill_rounded(r.rect, r.radius_x, r.radius_y, src);
+            }
+        }
+
+        void draw_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color,
+            float width = 1.0f
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || width <= 0.0f) return;
+            if (culled(stroke_bounds(center.x - radius_x, center.y - radius_y,
+                                     center.x + radius_x, center.y + radius_y, width))) return;
+            if (affine_) {
+                shape_.clear();
+                append_ellipse(center, radius_x, radius_y);
+                return stroke_shape(src, width);
+            }
+
+            double h = width * 0.5;
+            double rx = radius_x, ry = radius_y;
+            auto outer = detail::RoundedBox::make(
+                center.x - rx - h, center.y - ry - h, center.x + rx + h, center.y + ry + h, rx + h, ry + h);
+            auto inner = detail::RoundedBox::make(
+                center.x - rx + h, center.y - ry + h, center.x + rx - h, center.y + ry - h, rx - h, ry - h);
+            fill_rounded_box(outer, inner, src);
+        }
+
+        void fill_ellipse(
+            const basic_point<float>& center,
+            float radius_x,
+            float radius_y,
+            ColorU8 color
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0) return;
+            if (culled(stroke_bounds(center.x - radius_x, center.y - radius_y,
+                                     center.x + radius_x, center.y + radius_y, 0.0f))) return;
+            if (affine_) {
+                shape_.clear();
+                append_ellipse(center, radius_x, radius_y);
+                return fill_shape(src);
+            }
+
+            double rx = radius_x, ry = radius_y;
+            fill_rounded_box(
+                detail::RoundedBox::make(center.x - rx, center.y - ry, center.x + rx, center.y + ry, rx, ry),
+                detail::RoundedBox{},
+                src);
+        }
+
+        void fill_path(
+            const Path& path,
+            ColorU8 color,
+            FillRule rule = FillRule::NonZero,
+            const Transform& transform = Transform::identity()
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || path.empty() || culled(path_bounds(path, transform, nullptr))) return;
+            draw_path(path, affine_ ? transform * raster_transform_ : transform, rule, nullptr, src);
+        }
+
+        void stroke_path(
+            const Path& path,
+            ColorU8 color,
+            const StrokeStyle& style = StrokeStyle{},
+            const Transform& transform = Transform::identity()
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || path.empty() || style.width <= 0.0f) return;
+            if (culled(path_bounds(path, transform, &style))) return;
+            draw_path(path, affine_ ? transform * raster_transform_ : transform, FillRule::NonZero, &style, src);
+        }
+
+        // Glyph dari font FontCollection::global() yang cocok dengan format.
+        // Koleksi kosong: tiap glyph digambar sebagai kotak setinggi x-height
+        // dengan advance monospace (output tetap deterministik). Tanpa
+        // transform affine, mask glyph diambil dari GlyphAtlas (baseline
+        // di-snap ke pixel, pen x ke 1/4 pixel) dan di-blit lewat kernel
+        // masked blend; dengan transform, outline di-raster sebagai path.
+        void draw_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || text.empty()) return;
+
+            float size = text_format_size(text_format);
+            if (culled(text_bounds(text, rect, size))) return;
+
+            // Tanpa transform, baris di bawah clip tidak perlu di-layout
+            FontQuery query = text_format_query(text_format);
+            auto font = FontCollection::global().find(query);
+            float limit = affine_ ? std::numeric_limits<float>::infinity()
+                : static_cast<float>(clip_.y + clip_.h) - rect.y;
+            layout_text(text_layout_, text, rect.w, size, font.get(), limit);
+            draw_layout(text_layout_, font.get(), font ? font->id() : font_query_id(query), rect, size, src);
+        }
+
+        // Seperti draw_text, tapi glyph run diambil dari TextLayoutCache:
+        // teks, font, ukuran dan lebar box yang sama tidak di-layout ulang
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            uint32_t src = pack(color);
+            if (src == 0 || text.empty()) return;
+
+            float size = text_format_size(text_format);
+            if (culled(text_bounds(text, rect, size))) return;
+
+            FontQuery query = text_format_query(text_format);
+            auto font = FontCollection::global().find(query);
+            uint64_t font_id = font ? font->id() : font_query_id(query);
+
+            bool built = false;
+            auto layout = cached_layout(text, rect.w, size, font.get(), font_id, built);
+            ++(built ? frame_stats_.text_layout_misses : frame_stats_.text_layout_hits);
+            draw_layout(*layout, font.get(), font_id, rect, size, src);
+        }
+
+        // Bounds tinta layout cache (dibangun sekarang kalau belum ada, jadi
+        // draw_cached_text berikutnya hit) + 1px: snap baseline / pen x
+        // atlas dan coverage AA
+        basic_rect<float> cached_text_bounds(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            TextFormat* text_format = nullptr
+        ) override {
+            if (affine_) return Canvas::cached_text_bounds(text, rect, text_format);
+
+            FontQuery query = text_format_query(text_format);
+            auto font = FontCollection::global().find(query);
+            bool built = false;
+            auto layout = cached_layout(text, rect.w, text_format_size(text_format), font.get(),
+                font ? font->id() : font_query_id(query), built);
+            const basic_rect<float>& ink = layout->ink;
+            return basic_rect<float>(rect.x + ink.x - 1.0f, rect.y + ink.y - 1.0f, ink.w + 2.0f, ink.h + 2.0f);
+        }
+
+        // Advance dan metrik dari font yang sama dengan draw_text
+        TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) override {
+            auto font = FontCollection::global().find(text_format_query(text_format));
+            return measure_text_run(text, text_format_size(text_format), font.get(), advances);
+        }
+
+        // Layer = SoftwareCanvas seukuran bounds dengan origin di bounds
+        // (hanya translasi integer; transform lain digambar langsung)
+        std::unique_ptr<Canvas> create_layer(const basic_rect<int>& bounds) override {
+            if (affine_ || bounds.w <= 0 || bounds.h <= 0) return nullptr;
+            auto layer = std::make_unique<SoftwareCanvas>(bounds.get_size());
+            layer->set_origin(bounds.get_point());
+            layer->kernels_ = kernels_;
+            layer->blend_mode_ = blend_mode_;
+            return layer;
+        }
+
+        bool draw_layer(Canvas& layer, const basic_rect<int>& bounds) override {
+            auto* source = dynamic_cast<SoftwareCanvas*>(&layer);
+            if (!source || affine_) return false;
+
+            basic_rect<int> area = intersect(clip_, bounds.x, bounds.y, bounds.x + bounds.w, bounds.y + bounds.h);
+            area = intersect(area, source->origin_.x, source->origin_.y,
+                source->origin_.x + source->width_, source->origin_.y + source->height_);
+            for (int y = area.y; y < area.y + area.h; ++y) {
+                for_each_clip_span(y, area.x, area.x + area.w, [&](int x0, int x1) {
+                    kernels_.composite(pixel_ptr(x0, y), source->pixel_ptr(x0, y), static_cast<size_t>(x1 - x0));
+                });
+            }
+            return true;
+        }
+
+        // Blit dalam framebuffer: satu memmove per baris, urutan baris
+        // mengikuti arah geser supaya sumber tidak tertimpa sebelum disalin
+        bool scroll_rect(const basic_rect<int>& area, int dx, int dy) override {
+            if (!surface_) return false;
+
+            basic_rect<int> view = intersect(area, origin_.x, origin_.y, origin_.x + width_, origin_.y + height_);
+            basic_rect<int> src = intersect(view, view.x - dx, view.y - dy, view.x + view.w - dx, view.y + view.h - dy);
+            if (src.w <= 0 || src.h <= 0 || (dx == 0 && dy == 0)) return true;
+
+            size_t bytes = static_cast<size_t>(src.w) * sizeof(uint32_t);
+            auto row = [&](int y) {
+                return surface_ + static_cast<size_t>(y - origin_.y) * stride_ + (src.x - origin_.x);
+            };
+            if (dy > 0) {
+                for (int y = src.y + src.h - 1; y >= src.y; --y) {
+                    std::memmove(row(y + dy) + dx, row(y), bytes);
+                }
+            } else {
+                for (int y = src.y; y < src.y + src.h; ++y) {
+                    std::memmove(row(y + dy) + dx, row(y), bytes);
+                }
+            }
+            return true;
+        }
+
+        // Clipping
+        // Clip selalu axis-aligned: di bawah transform affine dipakai
+        // bounding box rect yang sudah ditransformasi (seperti D2D)
+        void push_clip(const basic_rect<float>& r) override {
+            clip_stack_.push_back({clip_, false});
+
+            basic_rect<float> rect = affine_ ? map_rect(r) : r;
+            int x0 = static_cast<int>(std::lround(rect.x));
+            int y0 = static_cast<int>(std::lround(rect.y));
+            int x1 = static_cast<int>(std::lround(rect.x + rect.w));
+            int y1 = static_cast<int>(std::lround(rect.y + rect.h));
+            clip_ = intersect(clip_, x0, y0, x1, y1);
+            track_device_clip();
+        }
+
+        // Region satu box cukup jadi clip rect biasa; selain itu span di-clip
+        // per baris terhadap box pada band yang memuat baris tersebut
+        void push_clip_region(const Region& region) override {
+            if (affine_) {
+                if (!raster_transform_.is_translation()) {
+                    basic_rect<int> b = region.bounds();
+                    return push_clip(basic_rect<float>(
+                        static_cast<float>(b.x), static_cast<float>(b.y),
+                        static_cast<float>(b.w), static_cast<float>(b.h)));
+                }
+                // Translasi pecahan: region dibulatkan ke piksel terdekat
+                Region moved = region;
+                moved.translate(static_cast<int>(std::lround(raster_transform_.dx)),
+                                static_cast<int>(std::lround(raster_transform_.dy)));
+                return push_region(moved);
+            }
+            push_region(region);
+        }
+
+        void pop_clip() override {
+            if (clip_stack_.empty()) return;
+            const ClipEntry& entry = clip_stack_.back();
+            clip_ = entry.rect;
+            if (entry.region && !region_stack_.empty()) {
+                clip_region_ = std::move(region_stack_.back().region);
+                has_clip_region_ = region_stack_.back().active;
+                region_stack_.pop_back();
+            }
+            clip_stack_.pop_back();
+            untrack_clip();
+        }
+
+        size_t clip_depth() const noexcept override {
+            return clip_stack_.size();
+        }
+
+        void set_transform(const Transform& transform) override {
+            Canvas::set_transform(transform);
+            raster_transform_ = transform;
+
+            bool integral = transform.is_translation()
+                && transform.dx == std::floor(transform.dx) && std::fabs(transform.dx) < 1e9f
+                && transform.dy == std::floor(transform.dy) && std::fabs(transform.dy) < 1e9f;
+            affine_ = !integral;
+            apply_shift(integral
+                ? basic_point<int>(static_cast<int>(transform.dx), static_cast<int>(transform.dy))
+                : basic_point<int>(0, 0));
+        }
+
+        bool is_valid() const noexcept override {
+            return width_ > 0 && height_ > 0;
+        }
+
+        // Framebuffer access
+        int width() const noexcept { return width_; }
+        int height() const noexcept { return height_; }
+        int stride() const noexcept { return stride_; }  // in pixels
+
+        basic_size<int> get_size() const noexcept {
+            return basic_size<int>(width_, height_);
+        }
+
+        const uint32_t* data() const noexcept { return surface_; }
+        uint32_t* data() noexcept { return surface_; }
+
+        const basic_point<int>& get_origin() const noexcept { return origin_; }
+
+        // Premultiplied BGRA8 packed as 0xAARRGGBB, koordinat canvas (device,
+        // tidak terpengaruh transform)
+        uint32_t pixel_at(int x, int y) const noexcept {
+            x -= origin_.x;
+            y -= origin_.y;
+            if (x < 0 || y < 0 || x >= width_ || y >= height_) return 0;
+            return surface_[static_cast<size_t>(y) * stride_ + x];
+        }
+
+        const basic_rect<int>& get_clip() const noexcept { return clip_; }
+
+        GeometryCache& get_geometry_cache() noexcept { return geometry_cache_; }
+
+        // Kernel span aktif; default level terbaik CPU, bisa diturunkan
+        // (benchmark, verifikasi hasil antar level)
+        void set_simd_level(SimdLevel level) noexcept {
+            kernels_ = span_kernels<pixel_format>(blend_mode_, level);
+        }
+
+        SimdLevel get_simd_level() const noexcept { return kernels_.level; }
+
+        // Ganti ruang blending. Pixel yang sudah ada tidak dikonversi, jadi
+        // set sebelum clear / frame pertama.
+        void set_blend_mode(BlendMode mode) noexcept {
+            blend_mode_ = mode;
+            kernels_ = span_kernels<pixel_format>(mode, kernels_.level);
+        }
+
+        BlendMode get_blend_mode() const noexcept { return blend_mode_; }
+
+        // Dump framebuffer sebagai BMP 32-bit top-down
+        bool write_bmp(const std::string& path) const {
+            std::ofstream file(path, std::ios::binary);
+            if (!file) return false;
+
+            uint32_t image_size = static_cast<uint32_t>(static_cast<size_t>(width_) * height_ * 4);
+            auto put16 = [&](uint16_t v) {
+                char b[2] = {static_cast<char>(v & 0xFF), static_cast<char>(v >> 8)};
+                file.write(b, 2);
+            };
+            auto put32 = [&](uint32_t v) {
+                char b[4] = {
+                    static_cast<char>(v & 0xFF), static_cast<char>((v >> 8) & 0xFF),
+                    static_cast<char>((v >> 16) & 0xFF), static_cast<char>(v >> 24)
+                };
+                file.write(b, 4);
+            };
+
+            // BITMAPFILEHEADER
+            put16(0x4D42);
+            put32(14 + 40 + image_size);
+            put32(0);
+            put32(14 + 40);
+            // BITMAPINFOHEADER
+            put32(40);
+            put32(static_cast<uint32_t>(width_));
+            put32(static_cast<uint32_t>(-height_));  // negative = top-down
+            put16(1);
+            put16(32);
+            put32(0);                               // BI_RGB
+            put32(image_size);
+            put32(2835);
+            put32(2835);
+            put32(0);
+            put32(0);
+
+            for (int y = 0; y < height_; ++y) {
+                for (int x = 0; x < width_; ++x) {
+                    put32(pixel_at(origin_.x + x, origin_.y + y));
+                }
+            }
+            return static_cast<bool>(file);
+        }
+
+    private:
+        // Pointer pixel (x, y) koordinat user; hanya untuk titik di dalam surface
+        uint32_t* pixel_ptr(int x, int y) noexcept {
+            return surface_ + static_cast<size_t>(y - user_origin_.y) * stride_ + (x - user_origin_.x);
+        }
+
+        uint8_t* coverage_ptr(int x) noexcept {
+            return coverage_.data() + (x - user_origin_.x);
+        }
+
+        // Warna -> pixel sesuai format dan encoding BlendMode
+        uint32_t pack(ColorU8 color) const noexcept {
+            uint32_t src = detail::pack_premultiplied<pixel_format>(color);
+            return blend_mode_ == BlendMode::Linear ? detail::to_linear_premultiplied<pixel_format>(src) : src;
+        }
+
+        // Pindah ke translasi integer baru: semua state berkoordinat user
+        // (origin, clip, stack clip, region) digeser sekali, primitive
+        // sesudahnya tidak perlu tahu ada transform
+        void apply_shift(const basic_point<int>& shift) {
+            int dx = shift.x - shift_.x;
+            int dy = shift.y - shift_.y;
+            if (dx == 0 && dy == 0) return;
+
+            shift_ = shift;
+            user_origin_ = basic_point<int>(origin_.x - shift.x, origin_.y - shift.y);
+            clip_.x -= dx;
+            clip_.y -= dy;
+            for (auto& entry : clip_stack_) {
+                entry.rect.x -= dx;
+                entry.rect.y -= dy;
+            }
+            if (has_clip_region_) {
+                clip_region_.translate(-dx, -dy);
+            }
+            for (auto& saved : region_stack_) {
+                saved.region.translate(-dx, -dy);
+            }
+        }
+
+        // Region satu box cukup jadi clip rect biasa; selain itu span di-clip
+        // per baris terhadap box pada band yang memuat baris tersebut
+        void push_region(const Region& region) {
+            if (region.is_rect()) {
+                basic_rect<int> b = region.bounds();
+                clip_stack_.push_back({clip_, false});
+                clip_ = intersect(clip_, b.x, b.y, b.x + b.w, b.y + b.h);
+                return track_device_clip();
+            }
+
+            clip_stack_.push_back({clip_, true});
+            region_stack_.push_back({clip_region_, has_clip_region_});
+
+            const Region::Box& e = region.extents();
+            clip_ = intersect(clip_, e.x1, e.y1, e.x2, e.y2);
+            if (has_clip_region_) {
+                clip_region_ &= region;
+            } else {
+                clip_region_ = region;
+            }
+            has_clip_region_ = true;
+            track_device_clip();
+        }
+
+        // clip_ ada di koordinat user tergeser; stack Canvas di device space
+        void track_device_clip() {
+            track_clip(basic_rect<float>(
+                static_cast<float>(clip_.x + shift_.x), static_cast<float>(clip_.y + shift_.y),
+                static_cast<float>(clip_.w), static_cast<float>(clip_.h)));
+        }
+
+        // Cull dengan bounds koordinat user (transform raster = user -> device)
+        bool culled(const basic_rect<float>& bounds) noexcept {
+            if (clip_bounds_.empty()) return false;
+            return cull(raster_transform_.is_identity() ? bounds : map_rect(raster_transform_, bounds));
+        }
+
+        static basic_rect<float> rect_bounds(const basic_rect<float>& rect, float width) noexcept {
+            return stroke_bounds(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, width);
+        }
+
+        // Jalur affine: shape_ (koordinat user) di-raster dengan transform penuh
+        void append_rounded(const basic_rect<float>& rect, float radius_x, float radius_y) {
+            float x0 = rect.x, y0 = rect.y, x1 = rect.x + rect.w, y1 = rect.y + rect.h;
+            float rx = std::min(radius_x, rect.w * 0.5f);
+            float ry = std::min(radius_y, rect.h * 0.5f);
+            if (rx <= 0.0f || ry <= 0.0f) {
+                shape_.move_to(x0, y0).line_to(x1, y0).line_to(x1, y1).line_to(x0, y1).close();
+                return;
+            }
+
+            // Kuadran ellipse sebagai cubic (kappa = 4/3 (sqrt 2 - 1))
+            constexpr float k = 0.5522847f;
+            float kx = rx * k, ky = ry * k;
+            shape_.move_to(x0 + rx, y0)
+                .line_to(x1 - rx, y0)
+                .cubic_to(x1 - rx + kx, y0, x1, y0 + ry - ky, x1, y0 + ry)
+                .line_to(x1, y1 - ry)
+                .cubic_to(x1, y1 - ry + ky, x1 - rx + kx, y1, x1 - rx, y1)
+                .line_to(x0 + rx, y1)
+                .cubic_to(x0 + rx - kx, y1, x0, y1 - ry + ky, x0, y1 - ry)
+                .line_to(x0, y0 + ry)
+                .cubic_to(x0, y0 + ry - ky, x0 + rx - kx, y0, x0 + rx, y0)
+                .close();
+        }
+
+        void append_ellipse(const basic_point<float>& center, float radius_x, float radius_y) {
+            append_rounded(
+                basic_rect<float>(center.x - radius_x, center.y - radius_y, radius_x * 2.0f, radius_y * 2.0f),
+                radius_x, radius_y);
+        }
+
+        void fill_shape(uint32_t src) {
+            draw_path(shape_, raster_transform_, FillRule::NonZero, nullptr, src);
+        }
+
+        void stroke_shape(uint32_t src, float width) {
+            StrokeStyle style;
+            style.width = width;
+            draw_path(shape_, raster_transform_, FillRule::NonZero, &style, src);
+        }
+
+        static basic_rect<int> intersect(const basic_rect<int>& a, int x0, int y0, int x1, int y1) noexcept {
+            int nx0 = std::max(a.x, x0);
+            int ny0 = std::max(a.y, y0);
+            int nx1 = std::min(a.x + a.w, x1);
+            int ny1 = std::min(a.y + a.h, y1);
+            if (nx1 <= nx0 || ny1 <= ny0) return basic_rect<int>(nx0, ny0, 0, 0);
+            return basic_rect<int>(nx0, ny0, nx1 - nx0, ny1 - ny0);
+        }
+
+        // Blend [x0, x1) on row y with constant coverage, clipped
+        void blend_span(int y, int x0, int x1, uint32_t src, uint32_t alpha = 255) {
+            if (y < clip_.y || y >= clip_.y + clip_.h || alpha == 0) return;
+            x0 = std::max(x0, clip_.x);
+            x1 = std::min(x1, clip_.x + clip_.w);
+            if (x1 <= x0) return;
+
+            uint32_t color = alpha == 255 ? src : detail::scale_pixel(src, alpha);
+            bool opaque = detail::alpha_of<pixel_format>(color) == 255;
+
+            auto kernel = opaque ? kernels_.fill : kernels_.blend;
+            for_each_clip_span(y, x0, x1, [&](int s0, int s1) {
+                kernel(pixel_ptr(s0, y), static_cast<size_t>(s1 - s0), color);
+            });
+        }
+
+        // Pecah [x0, x1) pada baris y menjadi bagian yang lolos region clip
+        template <typename Fn>
+        void for_each_clip_span(int y, int x0, int x1, Fn&& fn) const {
+            if (!has_clip_region_) {
+                fn(x0, x1);
+                return;
+            }
+
+            const auto& boxes = clip_region_.boxes();
+            auto it = std::partition_point(boxes.begin(), boxes.end(),
+                [y](const Region::Box& box) { return box.y2 <= y; });
+            if (it == boxes.end() || it->y1 > y) return;
+
+            int band = it->y1;
+            for (; it != boxes.end() && it->y1 == band; ++it) {
+                if (it->x2 <= x0) continue;
+                if (it->x1 >= x1) break;
+                fn(std::max(x0, it->x1), std::min(x1, it->x2));
+            }
+        }
+
+        // Stroke is centered on the outline: ring = outer - inner
+        void stroke_line(const basic_point<float>& start, const basic_point<float>& end, uint32_t src, float width) {
+            float dx = end.x - start.x;
+            float dy = end.y - start.y;
+            float length = std::sqrt(dx * dx + dy * dy);
+            if (length <= 0.0f) return;
+
+            // Flat caps (default D2D): oriented box around the segment
+            float ux = dx / length;
+            float uy = dy / length;
+            float mx = (start.x + end.x) * 0.5f;
+            float my = (start.y + end.y) * 0.5f;
+            float half_len = length * 0.5f;
+            float half_w = width * 0.5f;
+
+            float pad = half_w;
+            rasterize_sdf(
+                std::min(start.x, end.x) - pad,
+                std::min(start.y, end.y) - pad,
+                std::max(start.x, end.x) + pad,
+                std::max(start.y, end.y) + pad,
+                src,
+                [=](float px, float py) {
+                    float qx = px - mx;
+                    float qy = py - my;
+                    float along = std::fabs(qx * ux + qy * uy) - half_len;
+                    float across = std::fabs(qx * uy - qy * ux) - half_w;
+                    return std::max(along, across);
+                }
+            );
+        }
+
+        void fill_rounded(const basic_rect<float>& rect, float radius_x, float radius_y, uint32_t src) {
+            fill_rounded_box(
+                detail::RoundedBox::make(rect.x, rect.y, rect.x + rect.w, rect.y + rect.h, radius_x, radius_y),
+                detail::RoundedBox{},
+                src);
+        }
+
+        // Translasi integer jadi offset blit; sisanya (linear + pecahan) ikut
+        // key cache, jadi path yang sama di posisi integer lain tetap hit
+        void draw_path(const Path& path, const Transform& transform, FillRule rule,
+                       const StrokeStyle* stroke, uint32_t src) {
+            float ox = std::floor(transform.dx);
+            float oy = std::floor(transform.dy);
+            Transform local = transform;
+            local.dx -= ox;
+            local.dy -= oy;
+
+            uint64_t key = GeometryCache::key(path.hash(), local, rule, stroke);
+            uint64_t misses = geometry_cache_.misses();
+            const CoverageMask& mask = geometry_cache_.get(key, [&](CoverageMask& out) {
+                float tolerance = 0.2f / std::max(local.max_scale(), 1e-3f);
+                path.flatten(tolerance, contours_);
+
+                const std::vector<Contour>* outline = &contours_;
+                if (stroke) {
+                    stroked_.clear();
+                    detail::Stroker stroker(*stroke, tolerance, stroked_);
+                    for (const auto& contour : contours_) {
+                        stroker.stroke(contour);
+                    }
+                    outline = &stroked_;
+                }
+
+                path_rasterizer_.reset();
+                for (const auto& contour : *outline) {
+                    path_rasterizer_.add_contour(contour, local);
+                }
+                path_rasterizer_.build(stroke ? FillRule::NonZero : rule, out);
+            });
+
+            if (geometry_cache_.misses() != misses) {
+                ++frame_stats_.path_cache_misses;
+            } else {
+                ++frame_stats_.path_cache_hits;
+            }
+            blit_mask(mask, static_cast<int>(ox), static_cast<int>(oy), src);
+        }
+
+        void blit_mask(const CoverageMask& mask, int ox, int oy, uint32_t src) {
+            int cx0 = clip_.x, cx1 = clip_.x + clip_.w;
+            for (const auto& run : mask.runs) {
+                int y = run.y + oy;
+                if (y < clip_.y || y >= clip_.y + clip_.h) continue;
+
+                int x0 = run.x0 + ox, x1 = run.x1 + ox;
+                if (run.offset < 0) {
+                    blend_span(y, x0, x1, src, run.alpha);
+                    continue;
+                }
+
+                int a = std::max(x0, cx0), b = std::min(x1, cx1);
+                if (b <= a) continue;
+                std::copy_n(mask.alphas.data() + run.offset + (a - x0), b - a, coverage_ptr(a));
+                blend_row(y, a, b, src);
+            }
+        }
+
+        // Scanline exact-area coverage untuk outer minus inner (inner kosong =
+        // fill). Per baris hanya kolom yang dilewati tepi yang dihitung; di
+        // antaranya coverage konstan, jadi jadi satu blend_span solid. Biaya
+        // sebanding keliling, bukan luas.
+        void fill_rounded_box(const detail::RoundedBox& outer, const detail::RoundedBox& inner, uint32_t src) {
+            if (outer.empty()) return;
+
+            struct Range { int x0, x1; };
+            detail::RoundedBox outer_mirror = outer.mirrored();
+            detail::RoundedBox inner_mirror = inner.mirrored();
+
+            int cx0 = clip_.x, cx1 = clip_.x + clip_.w;
+            int row0 = std::max(static_cast<int>(std::floor(outer.y0)), clip_.y);
+            int row1 = std::min(static_cast<int>(std::ceil(outer.y1)), clip_.y + clip_.h);
+
+            for (int y = row0; y < row1; ++y) {
+                double ya = std::max<double>(y, outer.y0);
+                double yb = std::min<double>(y + 1, outer.y1);
+                if (yb <= ya) continue;
+
+                double ia = std::max<double>(y, inner.y0);
+                double ib = std::min<double>(y + 1, inner.y1);
+                bool has_inner = !inner.empty() && ib > ia;
+
+                auto coverage_at = [&](int px) {
+                    double c = detail::box_coverage(outer, outer_mirror, ya, yb, px);
+                    if (has_inner) c -= detail::box_coverage(inner, inner_mirror, ia, ib, px);
+                    return to_alpha(static_cast<float>(c));
+                };
+
+                // Kolom yang dilewati tepi pada baris ini
+                Range ranges[4];
+                int count = 0;
+                auto add_edge = [&](double lo, double hi) {
+                    int a = std::max(static_cast<int>(std::floor(lo)), cx0);
+                    int b = std::min(static_cast<int>(std::ceil(hi)), cx1);
+                    if (b > a) ranges[count++] = Range{a, b};
+                };
+
+                double lo, hi;
+                outer.left_extent(ya, yb, lo, hi);
+                int x_begin = std::max(static_cast<int>(std::floor(lo)), cx0);
+                add_edge(lo, hi);
+                outer.right_extent(ya, yb, lo, hi);
+                int x_end = std::min(static_cast<int>(std::ceil(hi)), cx1);
+                add_edge(lo, hi);
+                if (has_inner) {
+                    inner.left_extent(ia, ib, lo, hi);
+                    add_edge(lo, hi);
+                    inner.right_extent(ia, ib, lo, hi);
+                    add_edge(lo, hi);
+                }
+                for (int i = 1; i < count; ++i) {   // Insertion sort, maks 4 elemen
+                    for (int j = i; j > 0 && ranges[j].x0 < ranges[j - 1].x0; --j) {
+                        std::swap(ranges[j], ranges[j - 1]);
+                    }
+                }
+
+                int x = x_begin;
+                for (int i = 0; i < count; ++i) {
+                    int a = std::max(ranges[i].x0, x);
+                    int b = ranges[i].x1;
+                    if (b <= a) continue;
+
+                    if (a > x) {
+                        uint32_t alpha = coverage_at(x);
+                        if (alpha) blend_span(y, x, a, src, alpha);
+                    }
+                    for (int px = a; px < b; ++px) {
+                        *coverage_ptr(px) = static_cast<uint8_t>(coverage_at(px));
+                    }
+                    blend_row(y, a, b, src);
+                    x = b;
+                }
+                if (x < x_end) {
+                    uint32_t alpha = coverage_at(x);
+                    if (alpha) blend_span(y, x, x_end, src, alpha);
+                }
+            }
+        }
+
+        void stroke_rect(const basic_rect<float>& rect, uint32_t src, float width) {
+            float h = width * 0.5f;
+            float ox0 = rect.x - h, oy0 = rect.y - h;
+            float ox1 = rect.x + rect.w + h, oy1 = rect.y + rect.h + h;
+            float ix0 = rect.x + h, iy0 = rect.y + h;
+            float ix1 = rect.x + rect.w - h, iy1 = rect.y + rect.h - h;
+
+            if (ix1 <= ix0 || iy1 <= iy0) {
+                fill_area(ox0, oy0, ox1, oy1, src);
+                return;
+            }
+
+            fill_area(ox0, oy0, ox1, iy0, src);     // top
+            fill_area(ox0, iy1, ox1, oy1, src);     // bottom
+            fill_area(ox0, iy0, ix0, iy1, src);     // left
+            fill_area(ix1, iy0, ox1, iy1, src);     // right
+        }
+
+        // Exact area coverage of an axis-aligned box [x0,x1) x [y0,y1)
+        void fill_area(float x0, float y0, float x1, float y1, uint32_t src) {
+            if (x1 <= x0 || y1 <= y0) return;
+
+            int ix0 = static_cast<int>(std::floor(x0));
+            int ix1 = static_cast<int>(std::ceil(x1));
+            int iy0 = std::max(static_cast<int>(std::floor(y0)), clip_.y);
+            int iy1 = std::min(static_cast<int>(std::ceil(y1)), clip_.y + clip_.h);
+
+            // Single-column boxes collapse left and right edge into one pixel
+            float cov_left = std::min(x1, ix0 + 1.0f) - x0;
+            float cov_right = x1 - std::max(x0, ix1 - 1.0f);
+
+            for (int y = iy0; y < iy1; ++y) {
+                float cov_y = std::min(y1, y + 1.0f) - std::max(y0, static_cast<float>(y));
+                if (cov_y <= 0.0f) continue;
+
+                if (ix1 - ix0 == 1) {
+                    blend_span(y, ix0, ix1, src, to_alpha((x1 - x0) * cov_y));
+                    continue;
+                }
+
+                blend_span(y, ix0, ix0 + 1, src, to_alpha(cov_left * cov_y));
+                blend_span(y, ix0 + 1, ix1 - 1, src, to_alpha(cov_y));
+                blend_span(y, ix1 - 1, ix1, src, to_alpha(cov_right * cov_y));
+            }
+        }
+
+        // Anti-aliased shape dari signed distance (negatif = di dalam).
+        // Coverage = clamp(0.5 - d) di pusat pixel.
+        template <typename Sdf>
+        void rasterize_sdf(float bx0, float by0, float bx1, float by1, uint32_t src, Sdf&& sdf) {
+            int ix0 = std::max(static_cast<int>(std::floor(bx0)) - 1, clip_.x);
+            int iy0 = std::max(static_cast<int>(std::floor(by0)) - 1, clip_.y);
+            int ix1 = std::min(static_cast<int>(std::ceil(bx1)) + 1, clip_.x + clip_.w);
+            int iy1 = std::min(static_cast<int>(std::ceil(by1)) + 1, clip_.y + clip_.h);
+            if (ix1 <= ix0 || iy1 <= iy0) return;
+
+            for (int y = iy0; y < iy1; ++y) {
+                float py = y + 0.5f;
+                for (int x = ix0; x < ix1; ++x) {
+                    float cov = 0.5f - sdf(x + 0.5f, py);
+                    *coverage_ptr(x) = static_cast<uint8_t>(to_alpha(cov));
+                }
+                blend_row(y, ix0, ix1, src);
+            }
+        }
+
+        // Blend coverage_[x0..x1) on row y lewat kernel masked coverage
+        void blend_row(int y, int x0, int x1, uint32_t src) {
+            for_each_clip_span(y, x0, x1, [&](int s0, int s1) {
+                kernels_.blend_mask(pixel_ptr(s0, y), coverage_ptr(s0), static_cast<size_t>(s1 - s0), src);
+            });
+        }
+
+        // Glyph kotak placeholder: lebar 0.385 size mulai offset subpixel,
+        // tinggi 0.5 size di atas baseline; coverage area eksak seperti fill_area
+        static GlyphBitmap rasterize_box_glyph(uint32_t, float size, float subpixel) {
+            float glyph_w = size * 0.55f * 0.7f;
+            float glyph_h = size * 0.5f;
+            GlyphBitmap bitmap;
+            bitmap.width = static_cast<int>(std::ceil(subpixel + glyph_w));
+            bitmap.height = static_cast<int>(std::ceil(glyph_h));
+            bitmap.top = -bitmap.height;
+            bitmap.advance = size * 0.55f;
+            bitmap.coverage.resize(static_cast<size_t>(bitmap.width) * bitmap.height);
+
+            float top = bitmap.height - glyph_h;
+            for (int y = 0; y < bitmap.height; ++y) {
+                float cov_y = std::min(1.0f, y + 1.0f - std::max(top, static_cast<float>(y)));
+                for (int x = 0; x < bitmap.width; ++x) {
+                    float cov_x = std::min(subpixel + glyph_w, x + 1.0f) - std::max(subpixel, static_cast<float>(x));
+                    bitmap.coverage[static_cast<size_t>(y) * bitmap.width + x] =
+                        static_cast<uint8_t>(to_alpha(std::max(cov_x, 0.0f) * cov_y));
+                }
+            }
+            return bitmap;
+        }
+
+        static std::shared_ptr<const TextLayout> cached_layout(const std::wstring& text, float width,
+            float size, const Font* font, uint64_t font_id, bool& built) {
+            return TextLayoutCache::global().lookup(text, TextLayoutKey{font_id, size, width}, [&] {
+                built = true;
+                auto fresh = std::make_shared<TextLayout>();
+                layout_text(*fresh, text, width, size, font);
+                layout_ink(*fresh, size, font);
+                return std::shared_ptr<const TextLayout>(std::move(fresh));
+            });
+        }
+
+        static uint16_t glyph_size_key(float size) noexcept {
+            return static_cast<uint16_t>(std::clamp(size * 4.0f + 0.5f, 1.0f, 65535.0f));
+        }
+
+        // Gambar glyph run di box rect. font nullptr = glyph placeholder
+        // (id = code point). Glyph urut per baris: tanpa transform, berhenti
+        // di baris pertama yang top-nya di bawah clip.
+        void draw_layout(const TextLayout& layout, const Font* font, uint64_t font_id,
+            const basic_rect<float>& rect, float size, uint32_t src) {
+            if (affine_) {
+                shape_.clear();
+                float glyph_w = size * 0.55f * 0.7f;
+                float glyph_h = size * 0.5f;
+                for (const TextLayout::Glyph& g : layout.glyphs) {
+                    float x = rect.x + g.x;
+                    float baseline = rect.y + g.baseline;
+                    if (font) {
+                        font->outline(g.id, size, x, baseline, shape_);
+                    } else {
+                        append_rounded(basic_rect<float>(x, baseline - glyph_h, glyph_w, glyph_h), 0.0f, 0.0f);
+                    }
+                }
+                if (!shape_.empty()) fill_shape(src);
+                return;
+            }
+
+            GlyphKey key;
+            key.font = font_id;
+            key.size = glyph_size_key(size);
+            float bottom = static_cast<float>(clip_.y + clip_.h);
+            auto rasterize = [font](uint32_t glyph, float glyph_size, float subpixel) {
+                return font ? font->rasterize(glyph, glyph_size, subpixel)
+                    : rasterize_box_glyph(glyph, glyph_size, subpixel);
+            };
+            for (const TextLayout::Glyph& g : layout.glyphs) {
+                float baseline = rect.y + g.baseline;
+                if (baseline - layout.ascent >= bottom) break;
+                draw_glyph(key, g.id, rect.x + g.x, baseline, src, rasterize);
+            }
+        }
+
+        // Satu glyph lewat atlas; glyph yang jelas di luar clip tidak di-lookup.
+        // rasterize(glyph, size, subpixel) -> GlyphBitmap hanya dipanggil saat miss.
+        template <typename Rasterize>
+        void draw_glyph(GlyphKey key, uint32_t glyph, float pen_x, float baseline, uint32_t src, Rasterize&& rasterize) {
+            int q = static_cast<int>(std::floor(pen_x * GlyphAtlas::subpixel_steps + 0.5f));
+            int x = q >> GlyphAtlas::subpixel_shift;
+            int y = static_cast<int>(std::floor(baseline + 0.5f));
+            float size = key.size * 0.25f;
+            if (x - size >= clip_.x + clip_.w || x + size * 2.0f < clip_.x) return;
+            if (y - size * 1.5f >= clip_.y + clip_.h || y + size < clip_.y) return;
+
+            key.glyph = glyph;
+            key.subpixel = static_cast<uint8_t>(q & (GlyphAtlas::subpixel_steps - 1));
+            GlyphAtlas::Glyph cached = GlyphAtlas::global().lookup(key, [&] {
+                return rasterize(glyph, size, static_cast<float>(key.subpixel) / GlyphAtlas::subpixel_steps);
+            });
+            if (!cached.empty()) blit_glyph(cached, x + cached.left, y + cached.top, src);
+        }
+
+        // Mask coverage glyph dengan pojok kiri atas (x0, y0), di-clip per baris
+        void blit_glyph(const GlyphAtlas::Glyph& glyph, int x0, int y0, uint32_t src) {
+            int gx0 = std::max(x0, clip_.x);
+            int gx1 = std::min(x0 + glyph.width, clip_.x + clip_.w);
+            int gy0 = std::max(y0, clip_.y);
+            int gy1 = std::min(y0 + glyph.height, clip_.y + clip_.h);
+            if (gx1 <= gx0) return;
+
+            for (int y = gy0; y < gy1; ++y) {
+                const uint8_t* row = glyph.coverage + static_cast<size_t>(y - y0) * glyph.stride;
+                for_each_clip_span(y, gx0, gx1, [&](int s0, int s1) {
+                    kernels_.blend_mask(pixel_ptr(s0, y), row + (s0 - x0), static_cast<size_t>(s1 - s0), src);
+                });
+            }
+        }
+
+        static uint32_t to_alpha(float coverage) noexcept {
+            if (coverage <= 0.0f) return 0;
+            if (coverage >= 1.0f) return 255;
+            return static_cast<uint32_t>(coverage * 255.0f + 0.5f);
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,470 @@
+#pragma once
+
+#include "color.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ZWIDGET_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#else
+    #define ZWIDGET_SIMD_X86 0
+#endif
+
+// GCC/Clang butuh target attribute supaya intrinsic AVX2/SSE4.1 boleh dipakai
+// tanpa -mavx2 untuk seluruh TU; MSVC selalu mengizinkan intrinsic.
+#if ZWIDGET_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    #define ZWIDGET_TARGET_AVX2 __attribute__((target("avx2")))
+    #define ZWIDGET_TARGET_SSE41 __attribute__((target("sse4.1")))
+#else
+    #define ZWIDGET_TARGET_AVX2
+    #define ZWIDGET_TARGET_SSE41
+#endif
+
+namespace zuu::widget {
+
+    // Layout pixel 32-bit premultiplied, dibaca sebagai uint32_t little-endian.
+    //  Bgra8 - 0xAARRGGBB (DIB, D2D, SoftwareCanvas)
+    //  Rgba8 - 0xAABBGGRR (PNG, OpenGL)
+    //  Argb8 - 0xBBGGRRAA (alpha di byte pertama)
+    enum class PixelFormat : uint8_t {
+        Bgra8,
+        Rgba8,
+        Argb8
+    };
+
+    template <PixelFormat F>
+    struct PixelFormatTraits;
+
+    template <>
+    struct PixelFormatTraits<PixelFormat::Bgra8> {
+        static constexpr int alpha_shift = 24, red_shift = 16, green_shift = 8, blue_shift = 0;
+    };
+
+    template <>
+    struct PixelFormatTraits<PixelFormat::Rgba8> {
+        static constexpr int alpha_shift = 24, red_shift = 0, green_shift = 8, blue_shift = 16;
+    };
+
+    template <>
+    struct PixelFormatTraits<PixelFormat::Argb8> {
+        static constexpr int alpha_shift = 0, red_shift = 8, green_shift = 16, blue_shift = 24;
+    };
+
+    enum class SimdLevel : uint8_t {
+        Scalar,
+        Sse41,
+        Avx2
+    };
+
+    constexpr const char* to_string(SimdLevel level) noexcept {
+        switch (level) {
+            case SimdLevel::Avx2: return "avx2";
+            case SimdLevel::Sse41: return "sse4.1";
+            default: return "scalar";
+        }
+    }
+
+    // Inner loop rasterizer CPU. Semua pixel premultiplied; src konstan.
+    //  fill        - dst[i] = src
+    //  blend       - dst[i] = src over dst[i]
+    //  blend_mask  - dst[i] = (src * mask[i] / 255) over dst[i]
+    struct SpanKernels {
+        SimdLevel level;
+        void (*fill)(uint32_t* dst, size_t count, uint32_t src) noexcept;
+        void (*blend)(uint32_t* dst, size_t count, uint32_t src) noexcept;
+        void (*blend_mask)(uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src) noexcept;
+        void (*composite)(uint32_t* dst, const uint32_t* src, size_t count) noexcept;   // Source-over per pixel
+    };
+
+    namespace detail {
+
+        // (a * b) / 255 dengan pembulatan, tanpa pembagian
+        constexpr uint32_t mul_div255(uint32_t a, uint32_t b) noexcept {
+            uint32_t t = a * b + 128;
+            return (t + (t >> 8)) >> 8;
+        }
+
+        // ColorU8 (premultiplied, layout Bgra8) -> 32-bit sesuai format.
+        // Cuma swizzle; identitas untuk Bgra8.
+        template <PixelFormat F = PixelFormat::Bgra8>
+        constexpr uint32_t pack_premultiplied(ColorU8 color) noexcept {
+            using T = PixelFormatTraits<F>;
+            return (uint32_t(color.a()) << T::alpha_shift) | (uint32_t(color.r()) << T::red_shift)
+                | (uint32_t(color.g()) << T::green_shift) | (uint32_t(color.b()) << T::blue_shift);
+        }
+
+        template <PixelFormat F = PixelFormat::Bgra8>
+        constexpr uint32_t alpha_of(uint32_t pixel) noexcept {
+            return (pixel >> PixelFormatTraits<F>::alpha_shift) & 0xFF;
+        }
+
+        // Kalikan keempat channel dengan alpha 0..255 (dua channel per operasi)
+        constexpr uint32_t scale_pixel(uint32_t pixel, uint32_t alpha) noexcept {
+            uint32_t rb = (pixel & 0x00FF00FFu) * alpha + 0x00800080u;
+            rb = ((rb + ((rb >> 8) & 0x00FF00FFu)) >> 8) & 0x00FF00FFu;
+            uint32_t ag = ((pixel >> 8) & 0x00FF00FFu) * alpha + 0x00800080u;
+            ag = (ag + ((ag >> 8) & 0x00FF00FFu)) & 0xFF00FF00u;
+            return rb | ag;
+        }
+
+        // Porter-Duff source-over, kedua pixel premultiplied
+        template <PixelFormat F = PixelFormat::Bgra8>
+        constexpr uint32_t blend_over(uint32_t dst, uint32_t src) noexcept {
+            return src + scale_pixel(dst, 255 - alpha_of<F>(src));
+        }
+
+        // -- Scalar -------------------------------------------------------
+
+        inline void fill_scalar(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            std::fill(dst, dst + count, src);
+        }
+
+        template <PixelFormat F>
+        void blend_scalar(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            uint32_t inv = 255 - alpha_of<F>(src);
+            if (inv == 0) return fill_scalar(dst, count, src);
+            if (inv == 255 && src == 0) return;
+            for (size_t i = 0; i < count; ++i) {
+                dst[i] = src + scale_pixel(dst[i], inv);
+            }
+        }
+
+        template <PixelFormat F>
+        void blend_mask_scalar(uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t m = mask[i];
+                if (m == 0) continue;
+                uint32_t s = m == 255 ? src : scale_pixel(src, m);
+                dst[i] = blend_over<F>(dst[i], s);
+            }
+        }
+
+        template <PixelFormat F>
+        void composite_scalar(uint32_t* dst, const uint32_t* src, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t inv = 255 - alpha_of<F>(src[i]);
+                if (inv == 0) {
+                    dst[i] = src[i];
+                } else if (src[i] != 0) {
+                    dst[i] = src[i] + scale_pixel(dst[i], inv);
+                }
+            }
+        }
+
+#if ZWIDGET_SIMD_X86
+        // Byte alpha dalam pixel; dipakai untuk shuffle broadcast alpha
+        template <PixelFormat F>
+        inline constexpr int alpha_byte = PixelFormatTraits<F>::alpha_shift / 8;
+
+        // -- SSE4.1: 4 pixel per iterasi, 2 pixel per register 16-bit ---
+
+        // (x * y + 128 + ((x * y + 128) >> 8)) >> 8 per lane 16-bit,
+        // identik dengan mul_div255 / scale_pixel
+        ZWIDGET_TARGET_SSE41 inline __m128i div255_epu16(__m128i product) noexcept {
+            __m128i t = _mm_add_epi16(product, _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+
+        ZWIDGET_TARGET_SSE41 inline void fill_sse41(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            __m128i v = _mm_set1_epi32(static_cast<int>(src));
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+            }
+            for (; i < count; ++i) dst[i] = src;
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_SSE41 void blend_sse41(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            uint32_t inv = 255 - alpha_of<F>(src);
+            if (inv == 0) return fill_sse41(dst, count, src);
+            if (inv == 255 && src == 0) return;
+
+            __m128i zero = _mm_setzero_si128();
+            __m128i s = _mm_set1_epi32(static_cast<int>(src));
+            __m128i ia = _mm_set1_epi16(static_cast<short>(inv));
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                __m128i lo = div255_epu16(_mm_mullo_epi16(_mm_cvtepu8_epi16(d), ia));
+                __m128i hi = div255_epu16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia));
+                __m128i out = _mm_add_epi8(_mm_packus_epi16(lo, hi), s);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            }
+            for (; i < count; ++i) dst[i] = src + scale_pixel(dst[i], inv);
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_SSE41 void blend_mask_sse41(
+            uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src
+        ) noexcept {
+            constexpr char a = static_cast<char>(alpha_byte<F> * 2);
+            // Coverage byte k -> keempat lane 16-bit pixel k (dua pixel per register)
+            __m128i spread_lo = _mm_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+            __m128i spread_hi = _mm_setr_epi8(2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1);
+            // Lane alpha tiap pixel -> keempat lane pixel itu
+            __m128i alpha_spread = _mm_setr_epi8(
+                a, a + 1, a, a + 1, a, a + 1, a, a + 1,
+                a + 8, a + 9, a + 8, a + 9, a + 8, a + 9, a + 8, a + 9);
+
+            __m128i zero = _mm_setzero_si128();
+            __m128i s16 = _mm_cvtepu8_epi16(_mm_set1_epi32(static_cast<int>(src)));
+            __m128i c255 = _mm_set1_epi16(255);
+            bool opaque = alpha_of<F>(src) == 255;
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                uint32_t m4;
+                std::memcpy(&m4, mask + i, 4);
+                if (m4 == 0) continue;
+                if (m4 == 0xFFFFFFFFu && opaque) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_set1_epi32(static_cast<int>(src)));
+                    continue;
+                }
+
+                __m128i m = _mm_cvtsi32_si128(static_cast<int>(m4));
+                __m128i sc_lo = div255_epu16(_mm_mullo_epi16(s16, _mm_shuffle_epi8(m, spread_lo)));
+                __m128i sc_hi = div255_epu16(_mm_mullo_epi16(s16, _mm_shuffle_epi8(m, spread_hi)));
+                __m128i ia_lo = _mm_sub_epi16(c255, _mm_shuffle_epi8(sc_lo, alpha_spread));
+                __m128i ia_hi = _mm_sub_epi16(c255, _mm_shuffle_epi8(sc_hi, alpha_spread));
+
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                __m128i lo = _mm_add_epi16(sc_lo, div255_epu16(_mm_mullo_epi16(_mm_cvtepu8_epi16(d), ia_lo)));
+                __m128i hi = _mm_add_epi16(sc_hi, div255_epu16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia_hi)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+            }
+            blend_mask_scalar<F>(dst + i, mask + i, count - i, src);
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_SSE41 void composite_sse41(uint32_t* dst, const uint32_t* src, size_t count) noexcept {
+            constexpr char a = static_cast<char>(alpha_byte<F>);
+            // Alpha byte tiap pixel sumber -> keempat lane 16-bit pixel itu
+            __m128i alpha_lo = _mm_setr_epi8(a, -1, a, -1, a, -1, a, -1, a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1);
+            __m128i alpha_hi = _mm_setr_epi8(a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1,
+                a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1);
+            __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFFu << PixelFormatTraits<F>::alpha_shift));
+            __m128i zero = _mm_setzero_si128();
+            __m128i c255 = _mm_set1_epi16(255);
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                if (_mm_testz_si128(s, s)) continue;
+                __m128i sa = _mm_and_si128(s, alpha_mask);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, alpha_mask)) == 0xFFFF) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s);
+                    continue;
+                }
+
+                __m128i ia_lo = _mm_sub_epi16(c255, _mm_shuffle_epi8(s, alpha_lo));
+                __m128i ia_hi = _mm_sub_epi16(c255, _mm_shuffle_epi8(s, alpha_hi));
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                __m128i lo = div255_epu16(_mm_mullo_epi16(_mm_cvtepu8_epi16(d), ia_lo));
+                __m128i hi = div255_epu16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia_hi));
+                __m128i out = _mm_add_epi8(_mm_packus_epi16(lo, hi), s);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            }
+            composite_scalar<F>(dst + i, src + i, count - i);
+        }
+
+        // -- AVX2: 8 pixel per iterasi ----------------------------------
+
+        ZWIDGET_TARGET_AVX2 inline __m256i div255_epu16_avx2(__m256i product) noexcept {
+            __m256i t = _mm256_add_epi16(product, _mm256_set1_epi16(128));
+            return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+        }
+
+        ZWIDGET_TARGET_AVX2 inline void fill_avx2(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            __m256i v = _mm256_set1_epi32(static_cast<int>(src));
+            size_t i = 0;
+            for (; i + 32 <= count; i += 32) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 8), v);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), v);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 24), v);
+            }
+            for (; i + 8 <= count; i += 8) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+            }
+            for (; i < count; ++i) dst[i] = src;
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2 void blend_avx2(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            uint32_t inv = 255 - alpha_of<F>(src);
+            if (inv == 0) return fill_avx2(dst, count, src);
+            if (inv == 255 && src == 0) return;
+
+            __m256i zero = _mm256_setzero_si256();
+            __m256i s = _mm256_set1_epi32(static_cast<int>(src));
+            __m256i ia = _mm256_set1_epi16(static_cast<short>(inv));
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                __m256i lo = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), ia));
+                __m256i hi = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ia));
+                __m256i out = _mm256_add_epi8(_mm256_packus_epi16(lo, hi), s);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+            }
+            for (; i < count; ++i) dst[i] = src + scale_pixel(dst[i], inv);
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2 void blend_mask_avx2(
+            uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src
+        ) noexcept {
+            constexpr char a = static_cast<char>(alpha_byte<F> * 2);
+            // unpacklo/hi bekerja per lane 128-bit: lane 0 = pixel 0..3,
+            // lane 1 = pixel 4..7, jadi coverage disusun dengan layout sama
+            __m256i spread_lo = _mm256_setr_epi8(
+                0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+                0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1);
+            __m256i spread_hi = _mm256_setr_epi8(
+                2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1,
+                2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1);
+            __m256i alpha_spread = _mm256_setr_epi8(
+                a, a + 1, a, a + 1, a, a + 1, a, a + 1,
+                a + 8, a + 9, a + 8, a + 9, a + 8, a + 9, a + 8, a + 9,
+                a, a + 1, a, a + 1, a, a + 1, a, a + 1,
+                a + 8, a + 9, a + 8, a + 9, a + 8, a + 9, a + 8, a + 9);
+
+            __m256i zero = _mm256_setzero_si256();
+            __m256i s = _mm256_set1_epi32(static_cast<int>(src));
+            __m256i s16 = _mm256_unpacklo_epi8(s, zero);
+            __m256i c255 = _mm256_set1_epi16(255);
+            bool opaque = alpha_of<F>(src) == 255;
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                uint64_t m8;
+                std::memcpy(&m8, mask + i, 8);
+                if (m8 == 0) continue;
+                if (m8 == ~uint64_t{0} && opaque) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), s);
+                    continue;
+                }
+
+                __m256i m = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_cvtsi32_si128(static_cast<int>(m8 & 0xFFFFFFFFu))),
+                    _mm_cvtsi32_si128(static_cast<int>(m8 >> 32)), 1);
+                __m256i sc_lo = div255_epu16_avx2(_mm256_mullo_epi16(s16, _mm256_shuffle_epi8(m, spread_lo)));
+                __m256i sc_hi = div255_epu16_avx2(_mm256_mullo_epi16(s16, _mm256_shuffle_epi8(m, spread_hi)));
+                __m256i ia_lo = _mm256_sub_epi16(c255, _mm256_shuffle_epi8(sc_lo, alpha_spread));
+                __m256i ia_hi = _mm256_sub_epi16(c255, _mm256_shuffle_epi8(sc_hi, alpha_spread));
+
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                __m256i lo = _mm256_add_epi16(sc_lo,
+                    div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), ia_lo)));
+                __m256i hi = _mm256_add_epi16(sc_hi,
+                    div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ia_hi)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+            }
+            blend_mask_scalar<F>(dst + i, mask + i, count - i, src);
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2 void composite_avx2(uint32_t* dst, const uint32_t* src, size_t count) noexcept {
+            constexpr char a = static_cast<char>(alpha_byte<F>);
+            // Per lane 128-bit: unpacklo = pixel 0,1 (dan 4,5), unpackhi = 2,3 (dan 6,7)
+            __m256i alpha_lo = _mm256_setr_epi8(
+                a, -1, a, -1, a, -1, a, -1, a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1,
+                a, -1, a, -1, a, -1, a, -1, a + 4, -1, a + 4, -1, a + 4, -1, a + 4, -1);
+            __m256i alpha_hi = _mm256_setr_epi8(
+                a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1, a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1,
+                a + 8, -1, a + 8, -1, a + 8, -1, a + 8, -1, a + 12, -1, a + 12, -1, a + 12, -1, a + 12, -1);
+            __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFFu << PixelFormatTraits<F>::alpha_shift));
+            __m256i zero = _mm256_setzero_si256();
+            __m256i c255 = _mm256_set1_epi16(255);
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                if (_mm256_testz_si256(s, s)) continue;
+                __m256i sa = _mm256_and_si256(s, alpha_mask);
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, alpha_mask)) == -1) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), s);
+                    continue;
+                }
+
+                __m256i ia_lo = _mm256_sub_epi16(c255, _mm256_shuffle_epi8(s, alpha_lo));
+                __m256i ia_hi = _mm256_sub_epi16(c255, _mm256_shuffle_epi8(s, alpha_hi));
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                __m256i lo = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), ia_lo));
+                __m256i hi = div255_epu16_avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ia_hi));
+                __m256i out = _mm256_add_epi8(_mm256_packus_epi16(lo, hi), s);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+            }
+            composite_scalar<F>(dst + i, src + i, count - i);
+        }
+
+        inline SimdLevel detect_simd_level() noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            int max_leaf = info[0];
+            __cpuid(info, 1);
+            bool sse41 = (info[2] & (1 << 19)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            bool avx2 = false;
+            if (max_leaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+            }
+    #else
+            __builtin_cpu_init();
+            bool sse41 = __builtin_cpu_supports("sse4.1");
+            bool avx2 = __builtin_cpu_supports("avx2");
+    #endif
+            if (avx2) return SimdLevel::Avx2;
+            if (sse41) return SimdLevel::Sse41;
+            return SimdLevel::Scalar;
+        }
+#else
+        inline SimdLevel detect_simd_level() noexcept {
+            return SimdLevel::Scalar;
+        }
+#endif
+
+        template <PixelFormat F>
+        constexpr SpanKernels make_span_kernels(SimdLevel level) noexcept {
+#if ZWIDGET_SIMD_X86
+            if (level == SimdLevel::Avx2) {
+                return SpanKernels{level, &fill_avx2, &blend_avx2<F>, &blend_mask_avx2<F>, &composite_avx2<F>};
+            }
+            if (level == SimdLevel::Sse41) {
+                return SpanKernels{level, &fill_sse41, &blend_sse41<F>, &blend_mask_sse41<F>, &composite_sse41<F>};
+            }
+#endif
+            return SpanKernels{SimdLevel::Scalar, &fill_scalar, &blend_scalar<F>, &blend_mask_scalar<F>, &composite_scalar<F>};
+        }
+
+    } // namespace detail
+
+    // Level SIMD terbaik yang didukung CPU ini (dideteksi sekali)
+    inline SimdLevel cpu_simd_level() noexcept {
+        static const SimdLevel level = detail::detect_simd_level();
+        return level;
+    }
+
+    // Tabel kernel untuk format F; level di atas kemampuan CPU diturunkan
+    template <PixelFormat F>
+    SpanKernels span_kernels(SimdLevel level) noexcept {
+        return detail::make_span_kernels<F>(std::min(level, cpu_simd_level()));
+    }
+
+    // Tabel kernel terbaik untuk CPU ini
+    template <PixelFormat F>
+    const SpanKernels& span_kernels() noexcept {
+        static const SpanKernels kernels = detail::make_span_kernels<F>(cpu_simd_level());
+        return kernels;
+    }
+
+} // namespace zuu::widget
@@ -0,0 +1,397 @@
+#pragma once
+
+#include "span_kernels.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace zuu::widget {
+
+    // Ruang warna tempat blending SoftwareCanvas terjadi.
+    //  Srgb   - langsung pada byte tersimpan (cepat, default, sama dengan D2D)
+    //  Linear - gamma-correct: channel disimpan sebagai sRGB dari nilai linear
+    //           premultiplied, blend dihitung di ruang linear. Tepi AA dan
+    //           warna alpha rendah tidak lagi terlihat terlalu gelap.
+    enum class BlendMode : uint8_t {
+        Srgb,
+        Linear
+    };
+
+    constexpr const char* to_string(BlendMode mode) noexcept {
+        return mode == BlendMode::Linear ? "linear" : "srgb";
+    }
+
+    namespace detail {
+
+        // pow constexpr untuk membangun tabel saat compile (std::pow belum
+        // constexpr di semua compiler)
+        constexpr double cx_log(double x) noexcept {
+            int k = 0;
+            while (x > 2.0) { x *= 0.5; ++k; }
+            while (x < 1.0) { x *= 2.0; --k; }
+            // ln(x) = 2 atanh((x - 1) / (x + 1)), |y| <= 1/3
+            double y = (x - 1.0) / (x + 1.0), y2 = y * y, term = y, sum = 0.0;
+            for (int n = 1; n < 64; n += 2) {
+                sum += term / n;
+                term *= y2;
+            }
+            return 2.0 * sum + k * 0.69314718055994530942;
+        }
+
+        constexpr double cx_exp(double x) noexcept {
+            constexpr double ln2 = 0.69314718055994530942;
+            int k = static_cast<int>(x / ln2);
+            if (x < k * ln2) --k;
+            double r = x - k * ln2, term = 1.0, sum = 1.0;
+            for (int n = 1; n < 30; ++n) {
+                term *= r / n;
+                sum += term;
+            }
+            for (; k > 0; --k) sum *= 2.0;
+            for (; k < 0; ++k) sum *= 0.5;
+            return sum;
+        }
+
+        constexpr double srgb_decode(double v) noexcept {
+            return v <= 0.04045 ? v / 12.92 : cx_exp(2.4 * cx_log((v + 0.055) / 1.055));
+        }
+
+        constexpr double srgb_encode(double v) noexcept {
+            if (v <= 0.0) return 0.0;
+            return v <= 0.0031308 ? v * 12.92 : 1.055 * cx_exp(cx_log(v) / 2.4) - 0.055;
+        }
+
+        inline constexpr uint32_t linear_max = 4095;    // Linear 12-bit
+
+        // sRGB 8-bit -> linear 12-bit
+        inline constexpr auto srgb_to_linear_table = [] {
+            std::array<uint16_t, 256> table{};
+            for (size_t i = 0; i < table.size(); ++i) {
+                table[i] = static_cast<uint16_t>(srgb_decode(i / 255.0) * linear_max + 0.5);
+            }
+            return table;
+        }();
+
+        // Linear 12-bit -> sRGB 8-bit
+        inline constexpr auto linear_to_srgb_table = [] {
+            std::array<uint8_t, linear_max + 1> table{};
+            for (size_t i = 0; i < table.size(); ++i) {
+                table[i] = static_cast<uint8_t>(srgb_encode(static_cast<double>(i) / linear_max) * 255.0 + 0.5);
+            }
+            return table;
+        }();
+
+        template <PixelFormat F>
+        inline constexpr int color_shifts[3] = {
+            PixelFormatTraits<F>::red_shift, PixelFormatTraits<F>::green_shift, PixelFormatTraits<F>::blue_shift};
+
+        // Pixel premultiplied biasa (ColorU8 ter-pack) -> encoding BlendMode::Linear
+        template <PixelFormat F>
+        constexpr uint32_t to_linear_premultiplied(uint32_t pixel) noexcept {
+            uint32_t a = alpha_of<F>(pixel);
+            if (a == 0 || a == 255) return pixel;
+
+            uint32_t out = a << PixelFormatTraits<F>::alpha_shift;
+            for (int shift : color_shifts<F>) {
+                uint32_t c = std::min<uint32_t>(255, (((pixel >> shift) & 0xFF) * 255 + a / 2) / a);
+                uint32_t l = (srgb_to_linear_table[c] * a + 127) / 255;
+                out |= uint32_t(linear_to_srgb_table[l]) << shift;
+            }
+            return out;
+        }
+
+        // -- Scalar: tabel ------------------------------------------------
+
+        // src (linear 12-bit per channel, alpha sa) over dst
+        template <PixelFormat F>
+        constexpr uint32_t blend_linear_pixel(uint32_t dst, const uint32_t (&s)[3], uint32_t sa) noexcept {
+            uint32_t inv = 255 - sa;
+            uint32_t out = (sa + mul_div255(alpha_of<F>(dst), inv)) << PixelFormatTraits<F>::alpha_shift;
+            for (int c = 0; c < 3; ++c) {
+                int shift = color_shifts<F>[c];
+                uint32_t d = srgb_to_linear_table[(dst >> shift) & 0xFF];
+                uint32_t o = std::min(linear_max, s[c] + (d * inv + 127) / 255);
+                out |= uint32_t(linear_to_srgb_table[o]) << shift;
+            }
+            return out;
+        }
+
+        template <PixelFormat F>
+        constexpr void decode_linear(uint32_t pixel, uint32_t (&s)[3]) noexcept {
+            for (int c = 0; c < 3; ++c) {
+                s[c] = srgb_to_linear_table[(pixel >> color_shifts<F>[c]) & 0xFF];
+            }
+        }
+
+        template <PixelFormat F>
+        void blend_linear_scalar(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            uint32_t sa = alpha_of<F>(src);
+            if (sa == 255) return fill_scalar(dst, count, src);
+            if (src == 0) return;
+            uint32_t s[3];
+            decode_linear<F>(src, s);
+            for (size_t i = 0; i < count; ++i) {
+                dst[i] = blend_linear_pixel<F>(dst[i], s, sa);
+            }
+        }
+
+        template <PixelFormat F>
+        void blend_mask_linear_scalar(uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src) noexcept {
+            uint32_t sa = alpha_of<F>(src);
+            uint32_t s[3];
+            decode_linear<F>(src, s);
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t m = mask[i];
+                if (m == 0) continue;
+                if (m == 255) {
+                    dst[i] = sa == 255 ? src : blend_linear_pixel<F>(dst[i], s, sa);
+                    continue;
+                }
+                uint32_t sm[3] = {(s[0] * m + 127) / 255, (s[1] * m + 127) / 255, (s[2] * m + 127) / 255};
+                dst[i] = blend_linear_pixel<F>(dst[i], sm, mul_div255(sa, m));
+            }
+        }
+
+        template <PixelFormat F>
+        void composite_linear_scalar(uint32_t* dst, const uint32_t* src, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t sa = alpha_of<F>(src[i]);
+                if (sa == 255) {
+                    dst[i] = src[i];
+                } else if (src[i] != 0) {
+                    uint32_t s[3];
+                    decode_linear<F>(src[i], s);
+                    dst[i] = blend_linear_pixel<F>(dst[i], s, sa);
+                }
+            }
+        }
+
+#if ZWIDGET_SIMD_X86
+        // -- AVX2 + FMA: tanpa gather ----------------------------------
+        // Tabel diganti aproksimasi float: decode = polinom derajat 5 di
+        // byte (error < 0.25 LSB 12-bit), encode = polinom derajat 7 di
+        // sqrt(x) (error < 0.05 LSB 8-bit). Rantai polinom butuh FMA; tanpa
+        // FMA (dan untuk SSE4.1) jalur ini tidak lebih cepat dari tabel,
+        // jadi level tersebut memakai kernel tabel. Hasil bisa beda 1 LSB
+        // dari jalur tabel. Ekor span diproses lewat buffer lokal supaya
+        // hasil tidak bergantung pada posisi awal span (tile).
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define ZWIDGET_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+    #else
+        #define ZWIDGET_TARGET_AVX2_FMA
+    #endif
+
+        inline bool detect_fma() noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 12)) != 0;
+    #else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("fma");
+    #endif
+        }
+
+        inline bool cpu_has_fma() noexcept {
+            static const bool fma = detect_fma();
+            return fma;
+        }
+
+        // Koefisien di domain 0..1; di bawah dilipat ke skala byte
+        inline constexpr double srgb_decode_poly[6] = {
+            0.00109552269, 0.0286887051, 0.546454619, 0.59504769, -0.225735807, 0.0544815626};
+        inline constexpr double srgb_encode_poly[8] = {
+            -0.0433076763, 1.61250954, -2.32975945, 6.14744024,
+            -11.0190562, 11.9551271, -7.05518901, 1.73240955};
+
+        // decode(byte) langsung: c_k / 255^k
+        inline constexpr auto srgb_decode_byte_poly = [] {
+            std::array<float, 6> c{};
+            double scale = 1.0;
+            for (size_t k = 0; k < c.size(); ++k, scale /= 255.0) {
+                c[k] = static_cast<float>(srgb_decode_poly[k] * scale);
+            }
+            return c;
+        }();
+
+        // encode * 255 + 0.5 (pembulatan ikut dilipat ke c0)
+        inline constexpr auto srgb_encode_byte_poly = [] {
+            std::array<float, 8> c{};
+            for (size_t k = 0; k < c.size(); ++k) {
+                c[k] = static_cast<float>(srgb_encode_poly[k] * 255.0 + (k == 0 ? 0.5 : 0.0));
+            }
+            return c;
+        }();
+
+        // Byte 0..255 (int32) -> linear 0..1
+        ZWIDGET_TARGET_AVX2_FMA inline __m256 srgb_decode_avx2(__m256i bytes) noexcept {
+            __m256 x = _mm256_cvtepi32_ps(bytes);
+            __m256 p = _mm256_set1_ps(srgb_decode_byte_poly[5]);
+            for (int k = 4; k >= 0; --k) {
+                p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(srgb_decode_byte_poly[k]));
+            }
+            // Byte <= 10 adalah segmen linear (0.04045 * 255 = 10.3)
+            __m256 low = _mm256_mul_ps(x, _mm256_set1_ps(static_cast<float>(1.0 / (12.92 * 255.0))));
+            return _mm256_blendv_ps(p, low, _mm256_cmp_ps(x, _mm256_set1_ps(10.5f), _CMP_LE_OQ));
+        }
+
+        // Linear 0..1 -> byte 0..255 (int32); error polinom < 0.5, jadi
+        // hasil truncate sudah dalam 0..255 tanpa clamp akhir
+        ZWIDGET_TARGET_AVX2_FMA inline __m256i srgb_encode_avx2(__m256 v) noexcept {
+            v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+            __m256 q = _mm256_sqrt_ps(v);
+            __m256 p = _mm256_set1_ps(srgb_encode_byte_poly[7]);
+            for (int k = 6; k >= 0; --k) {
+                p = _mm256_fmadd_ps(p, q, _mm256_set1_ps(srgb_encode_byte_poly[k]));
+            }
+            __m256 low = _mm256_fmadd_ps(v, _mm256_set1_ps(12.92f * 255.0f), _mm256_set1_ps(0.5f));
+            p = _mm256_blendv_ps(p, low, _mm256_cmp_ps(v, _mm256_set1_ps(0.0031308f), _CMP_LE_OQ));
+            return _mm256_cvttps_epi32(p);
+        }
+
+        // Satu channel: shift sebagai template supaya ketiga channel di-unroll
+        template <int Shift>
+        ZWIDGET_TARGET_AVX2_FMA inline __m256i blend_channel_avx2(__m256i dst, __m256 s, __m256 inv) noexcept {
+            __m256 d = srgb_decode_avx2(_mm256_and_si256(_mm256_srli_epi32(dst, Shift), _mm256_set1_epi32(0xFF)));
+            return _mm256_slli_epi32(srgb_encode_avx2(_mm256_fmadd_ps(d, inv, s)), Shift);
+        }
+
+        // s[c] linear premultiplied, sa alpha int32 per lane
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA inline __m256i blend_linear_avx2(__m256i dst, const __m256 (&s)[3], __m256i sa) noexcept {
+            __m256i byte_mask = _mm256_set1_epi32(0xFF);
+            __m256i inv_i = _mm256_sub_epi32(byte_mask, sa);
+            __m256 inv = _mm256_mul_ps(_mm256_cvtepi32_ps(inv_i), _mm256_set1_ps(1.0f / 255.0f));
+
+            // Alpha: sa + mul_div255(da, inv), sama dengan jalur tabel
+            __m256i da = _mm256_and_si256(_mm256_srli_epi32(dst, PixelFormatTraits<F>::alpha_shift), byte_mask);
+            __m256i t = _mm256_add_epi32(_mm256_mullo_epi32(da, inv_i), _mm256_set1_epi32(128));
+            t = _mm256_srli_epi32(_mm256_add_epi32(t, _mm256_srli_epi32(t, 8)), 8);
+            __m256i out = _mm256_slli_epi32(_mm256_add_epi32(sa, t), PixelFormatTraits<F>::alpha_shift);
+
+            using T = PixelFormatTraits<F>;
+            out = _mm256_or_si256(out, blend_channel_avx2<T::red_shift>(dst, s[0], inv));
+            out = _mm256_or_si256(out, blend_channel_avx2<T::green_shift>(dst, s[1], inv));
+            return _mm256_or_si256(out, blend_channel_avx2<T::blue_shift>(dst, s[2], inv));
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA inline void decode_linear_avx2(__m256i pixels, __m256 (&s)[3]) noexcept {
+            using T = PixelFormatTraits<F>;
+            __m256i byte_mask = _mm256_set1_epi32(0xFF);
+            s[0] = srgb_decode_avx2(_mm256_and_si256(_mm256_srli_epi32(pixels, T::red_shift), byte_mask));
+            s[1] = srgb_decode_avx2(_mm256_and_si256(_mm256_srli_epi32(pixels, T::green_shift), byte_mask));
+            s[2] = srgb_decode_avx2(_mm256_and_si256(_mm256_srli_epi32(pixels, T::blue_shift), byte_mask));
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA void blend_linear_avx2_span(uint32_t* dst, size_t count, uint32_t src) noexcept {
+            uint32_t sa = alpha_of<F>(src);
+            if (sa == 255) return fill_avx2(dst, count, src);
+            if (src == 0) return;
+
+            __m256 s[3];
+            decode_linear_avx2<F>(_mm256_set1_epi32(static_cast<int>(src)), s);
+            __m256i a = _mm256_set1_epi32(static_cast<int>(sa));
+            uint32_t tail[8] = {};
+            for (size_t i = 0; i < count; i += 8) {
+                size_t n = std::min<size_t>(8, count - i);
+                uint32_t* p = n == 8 ? dst + i : static_cast<uint32_t*>(std::memcpy(tail, dst + i, n * 4));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), blend_linear_avx2<F>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), s, a));
+                if (p == tail) std::memcpy(dst + i, tail, n * 4);
+            }
+        }
+
+        // src * m / 255 over dst untuk 8 pixel; lane dengan m == 0 tetap dst
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA inline __m256i blend_mask_linear_avx2(
+            __m256i d, __m256i m, const __m256 (&s)[3], __m256i sa
+        ) noexcept {
+            __m256 mf = _mm256_mul_ps(_mm256_cvtepi32_ps(m), _mm256_set1_ps(1.0f / 255.0f));
+            __m256 sm[3] = {_mm256_mul_ps(s[0], mf), _mm256_mul_ps(s[1], mf), _mm256_mul_ps(s[2], mf)};
+            __m256i t = _mm256_add_epi32(_mm256_mullo_epi32(sa, m), _mm256_set1_epi32(128));
+            __m256i am = _mm256_srli_epi32(_mm256_add_epi32(t, _mm256_srli_epi32(t, 8)), 8);
+            __m256i out = blend_linear_avx2<F>(d, sm, am);
+            return _mm256_blendv_epi8(out, d, _mm256_cmpeq_epi32(m, _mm256_setzero_si256()));
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA void blend_mask_linear_avx2_span(
+            uint32_t* dst, const uint8_t* mask, size_t count, uint32_t src
+        ) noexcept {
+            __m256 s[3];
+            decode_linear_avx2<F>(_mm256_set1_epi32(static_cast<int>(src)), s);
+            __m256i sa = _mm256_set1_epi32(static_cast<int>(alpha_of<F>(src)));
+            uint32_t tail[8] = {};
+            uint8_t mask_tail[8] = {};
+            for (size_t i = 0; i < count; i += 8) {
+                size_t n = std::min<size_t>(8, count - i);
+                const uint8_t* m = n == 8 ? mask + i : static_cast<const uint8_t*>(std::memcpy(mask_tail, mask + i, n));
+                uint64_t m8;
+                std::memcpy(&m8, m, 8);
+                if (m8 == 0) continue;
+                uint32_t* p = n == 8 ? dst + i : static_cast<uint32_t*>(std::memcpy(tail, dst + i, n * 4));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), blend_mask_linear_avx2<F>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(m))), s, sa));
+                if (p == tail) std::memcpy(dst + i, tail, n * 4);
+            }
+        }
+
+        // Source-over per pixel; src == 0 tetap dst, src opaque langsung disalin
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA inline __m256i composite_linear_avx2(__m256i d, __m256i src) noexcept {
+            __m256i sa = _mm256_and_si256(
+                _mm256_srli_epi32(src, PixelFormatTraits<F>::alpha_shift), _mm256_set1_epi32(0xFF));
+            __m256 s[3];
+            decode_linear_avx2<F>(src, s);
+            __m256i out = blend_linear_avx2<F>(d, s, sa);
+            out = _mm256_blendv_epi8(out, src, _mm256_cmpeq_epi32(sa, _mm256_set1_epi32(0xFF)));
+            return _mm256_blendv_epi8(out, d, _mm256_cmpeq_epi32(src, _mm256_setzero_si256()));
+        }
+
+        template <PixelFormat F>
+        ZWIDGET_TARGET_AVX2_FMA void composite_linear_avx2_span(uint32_t* dst, const uint32_t* src, size_t count) noexcept {
+            uint32_t tail[8] = {}, src_tail[8] = {};
+            for (size_t i = 0; i < count; i += 8) {
+                size_t n = std::min<size_t>(8, count - i);
+                const uint32_t* q = n == 8 ? src + i : static_cast<const uint32_t*>(std::memcpy(src_tail, src + i, n * 4));
+                __m256i sv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+                if (_mm256_testz_si256(sv, sv)) continue;
+                uint32_t* p = n == 8 ? dst + i : static_cast<uint32_t*>(std::memcpy(tail, dst + i, n * 4));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), composite_linear_avx2<F>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), sv));
+                if (p == tail) std::memcpy(dst + i, tail, n * 4);
+            }
+        }
+#endif
+
+        // Fill tetap memakai versi SIMD level tersebut; blend memakai polinom
+        // AVX2 hanya bila CPU punya FMA, selain itu tabel
+        template <PixelFormat F>
+        inline SpanKernels make_linear_span_kernels(SimdLevel level) noexcept {
+#if ZWIDGET_SIMD_X86
+            if (level == SimdLevel::Avx2 && cpu_has_fma()) {
+                return SpanKernels{level, &fill_avx2, &blend_linear_avx2_span<F>,
+                    &blend_mask_linear_avx2_span<F>, &composite_linear_avx2_span<F>};
+            }
+            if (level >= SimdLevel::Sse41) {
+                return SpanKernels{level, level == SimdLevel::Avx2 ? &fill_avx2 : &fill_sse41,
+                    &blend_linear_scalar<F>, &blend_mask_linear_scalar<F>, &composite_linear_scalar<F>};
+            }
+#endif
+            return SpanKernels{SimdLevel::Scalar, &fill_scalar, &blend_linear_scalar<F>,
+                &blend_mask_linear_scalar<F>, &composite_linear_scalar<F>};
+        }
+
+    } // namespace detail
+
+    // Kernel span untuk mode blend tertentu; level di atas kemampuan CPU diturunkan
+    template <PixelFormat F>
+    SpanKernels span_kernels(BlendMode mode, SimdLevel level) noexcept {
+        level = std::min(level, cpu_simd_level());
+        return mode == BlendMode::Linear
+            ? detail::make_linear_span_kernels<F>(level)
+            : detail::make_span_kernels<F>(level);
+    }
+
+} // namespace zuu::widget
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "zwidget/detail/hash.hpp"
+#include "zwidget/detail/platform.hpp"
+
+#if ZWIDGET_PLATFORM_WIN32
+    #include <dwrite.h>
+
+    #ifdef min
+        #undef min
+    #endif
+    #ifdef max
+        #undef max
+    #endif
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace zuu::widget {
+
+    // Font yang diminta text format (tanpa ukuran); dipakai untuk memilih
+    // font di FontCollection dan sebagai key cache glyph
+    struct FontQuery {
+        std::wstring family{L"Segoe UI"};
+        uint16_t weight{400};
+        bool italic{false};
+    };
+
+#if ZWIDGET_PLATFORM_WIN32
+    using TextFormat = IDWriteTextFormat;
+
+    inline float text_format_size(const TextFormat* format) noexcept {
+        return format ? const_cast<TextFormat*>(format)->GetFontSize() : 14.0f;
+    }
+
+    inline FontQuery text_format_query(const TextFormat* format) {
+        FontQuery query;
+        if (!format) return query;
+        auto* f = const_cast<TextFormat*>(format);
+        query.family.assign(f->GetFontFamilyNameLength() + 1, L'\0');
+        f->GetFontFamilyName(query.family.data(), static_cast<UINT32>(query.family.size()));
+        query.family.resize(query.family.size() - 1);
+        query.weight = static_cast<uint16_t>(f->GetFontWeight());
+        query.italic = f->GetFontStyle() != DWRITE_FONT_STYLE_NORMAL;
+        return query;
+    }
+#else
+    // Portable description of a font, mirrors the fields we pass to
+    // IDWriteFactory::CreateTextFormat on Windows.
+    struct TextFormat {
+        std::wstring family{L"Segoe UI"};
+        float size{14.0f};
+        uint16_t weight{400};
+        bool italic{false};
+    };
+
+    inline float text_format_size(const TextFormat* format) noexcept {
+        return format ? format->size : 14.0f;
+    }
+
+    inline FontQuery text_format_query(const TextFormat* format) {
+        if (!format) return FontQuery{};
+        return FontQuery{format->family, format->weight, format->italic};
+    }
+#endif
+
+    // Identitas font (family, weight, style) untuk key cache glyph; ukuran
+    // tidak ikut karena disimpan terpisah di key
+    inline uint64_t font_query_id(const FontQuery& query) noexcept {
+        detail::StateHasher hasher;
+        return hasher.add(query.family)
+            .add(static_cast<uint32_t>(query.weight))
+            .add(static_cast<uint32_t>(query.italic))
+            .value();
+    }
+
+    inline uint64_t text_format_font_id(const TextFormat* format) {
+        return font_query_id(text_format_query(format));
+    }
+
+    // Hasil Canvas::measure_text untuk satu baris (tanpa wrap). width =
+    // jumlah advance; line_height = ascent + descent + line gap.
+    struct TextMetrics {
+        float width{0.0f};
+        float ascent{0.0f};
+        float descent{0.0f};
+        float line_height{0.0f};
+    };
+
+    // Hasil hit test: caret terdekat (index code unit) dan x-nya.
+    // inside = x jatuh di dalam teks, bukan sebelum / sesudahnya.
+    struct TextHit {
+        size_t position{0};
+        float x{0.0f};
+        bool inside{false};
+    };
+
+    // carets[i] = x caret sebelum code unit i (prefix sum advance, naik
+    // monoton, carets.size() = panjang teks + 1). Binary search O(log n),
+    // dibulatkan ke caret terdekat. Code unit ber-advance 0 (low surrogate,
+    // sisa cluster) ikut unit sebelumnya, jadi caret tidak jatuh di dalamnya.
+    inline TextHit hit_test_carets(std::span<const float> carets, float x) noexcept {
+        if (carets.empty()) return TextHit{};
+        auto it = std::upper_bound(carets.begin(), carets.end(), x);
+        if (it == carets.begin()) return TextHit{0, carets.front(), false};
+        if (it == carets.end()) return TextHit{carets.size() - 1, carets.back(), false};
+
+        size_t after = static_cast<size_t>(it - carets.begin());
+        size_t before = after - 1;
+        while (after + 1 < carets.size() && carets[after + 1] == carets[after]) ++after;
+        size_t nearest = x - carets[before] <= carets[after] - x ? before : after;
+        return TextHit{nearest, carets[nearest], true};
+    }
+
+} // namespace zuu::widget
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "font.hpp"
+#include "text_format.hpp"
+#include "zwidget/detail/hash.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Glyph run hasil layout, posisi relatif terhadap pojok kiri atas box.
+    // id = index glyph font, atau code point untuk layout placeholder
+    // (tanpa font). Glyph urut per baris, jadi baseline tidak pernah turun.
+    struct TextLayout {
+        struct Glyph {
+            uint32_t id;
+            float x;
+            float baseline;
+        };
+
+        std::vector<Glyph> glyphs;
+        float width{0.0f};                          // Baris terpanjang (pen x terjauh)
+        float height{0.0f};                         // lines * line_height
+        float ascent{0.0f};
+        float line_height{0.0f};
+        uint32_t lines{0};
+        basic_rect<float> ink;                      // Bounds outline glyph (layout_ink), relatif box
+
+        size_t bytes() const noexcept {
+            return sizeof(TextLayout) + glyphs.capacity() * sizeof(Glyph);
+        }
+    };
+
+    // Layout satu string di box selebar width: wrap per karakter seperti
+    // DrawText, '\n' memaksa baris baru, tab dianggap spasi. Dengan font,
+    // advance dan kerning dari font (surrogate UTF-16 digabung); tanpa
+    // font, metrik placeholder monospace SoftwareCanvas. Layout berhenti
+    // di baris pertama yang top-nya >= limit (sisa teks di luar clip).
+    inline void layout_text(
+        TextLayout& out,
+        const std::wstring& text,
+        float width,
+        float size,
+        const Font* font,
+        float limit = std::numeric_limits<float>::infinity()
+    ) {
+        out.glyphs.clear();
+        if (font) {
+            Font::Metrics metrics = font->metrics(size);
+            out.ascent = metrics.ascent;
+            out.line_height = metrics.line_height();
+        } else {
+            out.ascent = size;
+            out.line_height = size * 1.3f;
+        }
+
+        float x = 0.0f;
+        float extent = 0.0f;
+        float baseline = out.ascent;
+        uint32_t lines = 1;
+        uint32_t prev = 0;
+        uint32_t space = font ? font->glyph_index(U' ') : 0;
+
+        auto new_line = [&] {
+            extent = std::max(extent, x);
+            x = 0.0f;
+            baseline += out.line_height;
+            prev = 0;
+            ++lines;
+        };
+
+        for (size_t i = 0; i < text.size(); ++i) {
+            char32_t ch = static_cast<char32_t>(text[i]);
+            if (ch == U'\n') {
+                new_line();
+                continue;
+            }
+            if constexpr (sizeof(wchar_t) == 2) {
+                if (font && ch >= 0xD800 && ch < 0xDC00 && i + 1 < text.size() && text[i + 1] >= 0xDC00 && text[i + 1] < 0xE000) {
+                    ch = 0x10000 + ((ch - 0xD800) << 10) + (static_cast<char32_t>(text[++i]) - 0xDC00);
+                }
+            }
+
+            uint32_t glyph = static_cast<uint32_t>(ch);
+            float advance = size * 0.55f;
+            if (font) {
+                glyph = ch == U'\t' ? space : font->glyph_index(ch);
+                advance = font->advance(glyph, size);
+                x += font->kerning(prev, glyph, size);
+            }
+            if (x > 0.0f && x + advance > width) new_line();
+            if (baseline - out.ascent >= limit) {
+                --lines;
+                break;
+            }
+
+            if (ch != U' ' && ch != U'\t') {
+                out.glyphs.push_back(TextLayout::Glyph{glyph, x, baseline});
+            }
+            x += advance;
+            prev = glyph;
+        }
+
+        out.width = std::max(extent, x);
+        out.lines = lines;
+        out.height = static_cast<float>(lines) * out.line_height;
+    }
+
+    // Isi out.ink dari bounding box glyph (header glyf; placeholder = kotak
+    // x-height seperti glyph box SoftwareCanvas). Satu lookup glyf per
+    // glyph, jadi hanya untuk layout yang di-cache.
+    inline void layout_ink(TextLayout& out, float size, const Font* font) {
+        float x0 = std::numeric_limits<float>::infinity(), y0 = x0;
+        float x1 = -x0, y1 = -x0;
+        for (const TextLayout::Glyph& g : out.glyphs) {
+            basic_rect<float> box(0.0f, -size * 0.5f, size * 0.55f * 0.7f, size * 0.5f);
+            if (font && !font->glyph_bounds(g.id, size, box)) continue;
+            x0 = std::min(x0, g.x + box.x);
+            y0 = std::min(y0, g.baseline + box.y);
+            x1 = std::max(x1, g.x + box.x + box.w);
+            y1 = std::max(y1, g.baseline + box.y + box.h);
+        }
+        out.ink = x0 <= x1 ? basic_rect<float>(x0, y0, x1 - x0, y1 - y0) : basic_rect<float>();
+    }
+
+    // Ukur satu baris dengan metrik yang sama seperti layout_text (tanpa
+    // wrap; '\n' ber-advance 0 dan memutus kerning). Kerning pasangan
+    // ditambahkan ke advance unit kiri, jadi prefix sum advances = x pen.
+    inline TextMetrics measure_text_run(
+        const std::wstring& text,
+        float size,
+        const Font* font,
+        std::vector<float>* advances = nullptr
+    ) {
+        TextMetrics result;
+        if (font) {
+            Font::Metrics metrics = font->metrics(size);
+            result.ascent = metrics.ascent;
+            result.descent = metrics.descent;
+            result.line_height = metrics.line_height();
+        } else {
+            result.ascent = size;
+            result.descent = size * 0.3f;
+            result.line_height = size * 1.3f;
+        }
+        if (advances) advances->assign(text.size(), 0.0f);
+
+        float x = 0.0f;
+        uint32_t prev = 0;
+        size_t prev_index = 0;
+        uint32_t space = font ? font->glyph_index(U' ') : 0;
+
+        for (size_t i = 0; i < text.size(); ++i) {
+            size_t start = i;
+            char32_t ch = static_cast<char32_t>(text[i]);
+            if (ch == U'\n') {
+                prev = 0;
+                continue;
+            }
+            if constexpr (sizeof(wchar_t) == 2) {
+                if (font && ch >= 0xD800 && ch < 0xDC00 && i + 1 < text.size() && text[i + 1] >= 0xDC00 && text[i + 1] < 0xE000) {
+                    ch = 0x10000 + ((ch - 0xD800) << 10) + (static_cast<char32_t>(text[++i]) - 0xDC00);
+                }
+            }
+
+            float advance = size * 0.55f;
+            uint32_t glyph = static_cast<uint32_t>(ch);
+            if (font) {
+                glyph = ch == U'\t' ? space : font->glyph_index(ch);
+                advance = font->advance(glyph, size);
+                float kern = prev ? font->kerning(prev, glyph, size) : 0.0f;
+                x += kern;
+                if (advances && prev) (*advances)[prev_index] += kern;
+            }
+            if (advances) (*advances)[start] = advance;
+            x += advance;
+            prev = glyph;
+            prev_index = start;
+        }
+
+        result.width = x;
+        return result;
+    }
+
+    // Identitas layout selain teks: font (Font::id, atau font_query_id
+    // untuk placeholder), ukuran dan box. height hanya dipakai backend
+    // yang alignment vertikalnya bergantung tinggi box (DirectWrite).
+    struct TextLayoutKey {
+        uint64_t font{0};
+        float size{0.0f};
+        float width{0.0f};
+        float height{0.0f};
+
+        bool operator==(const TextLayoutKey&) const = default;
+    };
+
+    // BasicTextLayoutCache - layout teks yang dipakai ulang antar frame,
+    // di-key hash (teks, font, ukuran, box). Teks disimpan di entry untuk
+    // verifikasi, jadi tabrakan hash hanya berarti miss. Teks atau lebar
+    // yang berubah = key baru; entry lama menua dan di-evict LRU saat total
+    // byte melewati budget. Layout dipegang shared_ptr, jadi tetap aman
+    // dipakai worker tile walau di-evict. Layout::bytes() = perkiraan memori.
+    template <typename Layout>
+    class BasicTextLayoutCache {
+    private:
+        struct Entry {
+            uint64_t hash;
+            std::wstring text;
+            TextLayoutKey key;
+            std::shared_ptr<const Layout> layout;
+            size_t bytes;
+        };
+
+        using List = std::list<Entry>;
+
+        mutable std::mutex mutex_;
+        List lru_;                                          // Depan = paling baru dipakai
+        std::unordered_map<uint64_t, typename List::iterator> index_;
+        size_t budget_{1u << 20};
+        size_t bytes_{0};
+        uint64_t hits_{0};
+        uint64_t misses_{0};
+        uint64_t evictions_{0};
+
+        static uint64_t hash_of(const std::wstring& text, const TextLayoutKey& key) noexcept {
+            detail::StateHasher hasher;
+            hasher.add(text).add(key.font).add(key.size).add(key.width).add(key.height);
+            return hasher.value();
+        }
+
+        void erase(typename List::iterator it) {
+            bytes_ -= it->bytes;
+            index_.erase(it->hash);
+            lru_.erase(it);
+        }
+
+        // Evict dari belakang sampai muat; entry terdepan (baru masuk) dipertahankan
+        void trim() {
+            while (bytes_ > budget_ && lru_.size() > 1) {
+                erase(std::prev(lru_.end()));
+                ++evictions_;
+            }
+        }
+
+        std::shared_ptr<const Layout> find(uint64_t hash, const std::wstring& text, const TextLayoutKey& key) {
+            auto it = index_.find(hash);
+            if (it == index_.end() || it->second->key != key || it->second->text != text) return nullptr;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return lru_.front().layout;
+        }
+
+    public:
+        BasicTextLayoutCache() = default;
+
+        BasicTextLayoutCache(const BasicTextLayoutCache&) = delete;
+        BasicTextLayoutCache& operator=(const BasicTextLayoutCache&) = delete;
+
+        static BasicTextLayoutCache& global() {
+            static BasicTextLayoutCache cache;
+            return cache;
+        }
+
+        // Layout dari cache; kalau miss, build() -> shared_ptr<const Layout>
+        // dipanggil di luar lock. build() boleh mengembalikan nullptr (gagal,
+        // tidak di-cache).
+        template <typename Build>
+        std::shared_ptr<const Layout> lookup(const std::wstring& text, const TextLayoutKey& key, Build&& build) {
+            uint64_t hash = hash_of(text, key);
+            {
+                std::lock_guard lock(mutex_);
+                if (auto layout = find(hash, text, key)) {
+                    ++hits_;
+                    return layout;
+                }
+                ++misses_;
+            }
+
+            std::shared_ptr<const Layout> layout = build();
+            if (!layout) return nullptr;
+
+            std::lock_guard lock(mutex_);
+            if (auto existing = find(hash, text, key)) return existing;     // Thread lain lebih dulu
+            if (auto it = index_.find(hash); it != index_.end()) {
+                erase(it->second);                                          // Tabrakan hash
+            }
+
+            size_t bytes = sizeof(Entry) + text.size() * sizeof(wchar_t) + layout->bytes();
+            lru_.push_front(Entry{hash, text, key, layout, bytes});
+            index_[hash] = lru_.begin();
+            bytes_ += bytes;
+            trim();
+            return layout;
+        }
+
+        void clear() {
+            std::lock_guard lock(mutex_);
+            lru_.clear();
+            index_.clear();
+            bytes_ = 0;
+        }
+
+        void set_byte_budget(size_t bytes) {
+            std::lock_guard lock(mutex_);
+            budget_ = bytes;
+            trim();
+        }
+
+        void reset_stats() {
+            std::lock_guard lock(mutex_);
+            hits_ = misses_ = evictions_ = 0;
+        }
+
+        size_t byte_budget() const { std::lock_guard lock(mutex_); return budget_; }
+        size_t bytes_held() const { std::lock_guard lock(mutex_); return bytes_; }
+        size_t size() const { std::lock_guard lock(mutex_); return lru_.size(); }
+        uint64_t hits() const { std::lock_guard lock(mutex_); return hits_; }
+        uint64_t misses() const { std::lock_guard lock(mutex_); return misses_; }
+        uint64_t evictions() const { std::lock_guard lock(mutex_); return evictions_; }
+    };
+
+    // Cache glyph run SoftwareCanvas (satu per proses, dipakai semua canvas)
+    using TextLayoutCache = BasicTextLayoutCache<TextLayout>;
+
+} // namespace zuu::widget
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "zwidget/unit/point.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace zuu::widget {
+
+    // Affine 2D, konvensi sama dengan D2D1_MATRIX_3X2_F (vektor baris):
+    //   x' = x * m11 + y * m21 + dx
+    //   y' = x * m12 + y * m22 + dy
+    struct Transform {
+        float m11{1.0f}, m12{0.0f};
+        float m21{0.0f}, m22{1.0f};
+        float dx{0.0f}, dy{0.0f};
+
+        static constexpr Transform identity() noexcept {
+            return Transform{};
+        }
+
+        static constexpr Transform translation(float x, float y) noexcept {
+            return Transform{1.0f, 0.0f, 0.0f, 1.0f, x, y};
+        }
+
+        static constexpr Transform scale(float sx, float sy) noexcept {
+            return Transform{sx, 0.0f, 0.0f, sy, 0.0f, 0.0f};
+        }
+
+        static Transform rotation(float radians) noexcept {
+            float c = std::cos(radians), s = std::sin(radians);
+            return Transform{c, s, -s, c, 0.0f, 0.0f};
+        }
+
+        constexpr bool operator==(const Transform&) const noexcept = default;
+
+        // (*this) lalu o: titik ditransformasi dulu oleh *this, kemudian o
+        constexpr Transform operator*(const Transform& o) const noexcept {
+            return Transform{
+                m11 * o.m11 + m12 * o.m21,
+                m11 * o.m12 + m12 * o.m22,
+                m21 * o.m11 + m22 * o.m21,
+                m21 * o.m12 + m22 * o.m22,
+                dx * o.m11 + dy * o.m21 + o.dx,
+                dx * o.m12 + dy * o.m22 + o.dy
+            };
+        }
+
+        constexpr basic_point<float> apply(const basic_point<float>& p) const noexcept {
+            return basic_point<float>(p.x * m11 + p.y * m21 + dx, p.x * m12 + p.y * m22 + dy);
+        }
+
+        constexpr bool is_translation() const noexcept {
+            return m11 == 1.0f && m12 == 0.0f && m21 == 0.0f && m22 == 1.0f;
+        }
+
+        // Tanpa rotasi / skew: rect tetap rect setelah transform
+        constexpr bool is_axis_aligned() const noexcept {
+            return m12 == 0.0f && m21 == 0.0f;
+        }
+
+        constexpr bool is_identity() const noexcept {
+            return is_translation() && dx == 0.0f && dy == 0.0f;
+        }
+
+        // Faktor skala terbesar (untuk toleransi flattening dan lebar stroke)
+        float max_scale() const noexcept {
+            float sx = std::sqrt(m11 * m11 + m12 * m12);
+            float sy = std::sqrt(m21 * m21 + m22 * m22);
+            return std::max(sx, sy);
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "zwidget/core/window_state.hpp"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <shared_mutex>
+#include <mutex>
+#include <atomic>
+
+namespace zuu::widget {
+
+    class Window;
+	class EventDispatcher;
+
+    // Application headless - tidak ada window class / HINSTANCE. Window
+    // virtual didaftarkan dengan id numerik sebagai pengganti HWND.
+    class Application {
+        friend class Window;
+		friend class EventDispatcher;
+
+    public:
+        using WindowId = uint32_t;
+
+    private:
+        static inline std::unordered_map<WindowId, Window*> window_registry_{};
+        static inline std::shared_mutex registry_mutex_{};
+
+        static inline std::atomic<bool> is_running_{true};
+        static inline std::string window_class_name_;
+        static inline std::atomic<bool> class_registered_{false};
+        static inline std::atomic<WindowId> next_window_id_{1};
+
+        static WindowId allocate_window_id() noexcept {
+            return next_window_id_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void register_window(WindowId id, Window* window) noexcept {
+            if (id && window) {
+                std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+                window_registry_[id] = window;
+            }
+        }
+
+        static void unregister_window(WindowId id) noexcept {
+            if (id) {
+                std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+                window_registry_.erase(id);
+            }
+        }
+
+        static Window* get_window(WindowId id) noexcept {
+			std::shared_lock<std::shared_mutex> lock(registry_mutex_);
+			auto it = window_registry_.find(id);
+			return (it != window_registry_.end()) ? it->second : nullptr;
+		}
+
+        // Snapshot supaya iterasi tidak memegang lock selama callback jalan
+        static std::vector<Window*> get_windows() {
+            std::shared_lock<std::shared_mutex> lock(registry_mutex_);
+            std::vector<Window*> windows;
+            windows.reserve(window_registry_.size());
+            for (const auto& [_, window] : window_registry_) {
+                windows.push_back(window);
+            }
+            return windows;
+        }
+
+        // Dipanggil Window saat virtual window hancur (pengganti WM_DESTROY)
+        static void on_window_destroyed(WindowId id);
+
+    public:
+        Application() = delete;
+        Application(const Application&) = delete;
+        Application(Application&&) = delete;
+        Application& operator=(const Application&) = delete;
+        Application& operator=(Application&&) = delete;
+
+        static bool initialize(const std::string& window_class_name = "ZWidgetWindowClass") {
+            if (class_registered_.load(std::memory_order_acquire)) {
+                return true;
+            }
+
+            window_class_name_ = window_class_name;
+            class_registered_.store(true, std::memory_order_release);
+            is_running_.store(true, std::memory_order_release);
+            return true;
+        }
+
+        // Didefinisikan di platform/headless/window.hpp (butuh Window lengkap)
+        static void shutdown() noexcept;
+
+        static bool is_running() noexcept {
+            return is_running_.load(std::memory_order_acquire);
+        }
+
+        static size_t window_count() noexcept {
+            std::shared_lock<std::shared_mutex> lock(registry_mutex_);
+            return window_registry_.size();
+        }
+
+        static const std::string& get_window_class_name() noexcept {
+            return window_class_name_;
+        }
+
+        static bool is_class_registered() noexcept {
+            return class_registered_.load(std::memory_order_acquire);
+        }
+    };
+
+} // namespace zuu::widget
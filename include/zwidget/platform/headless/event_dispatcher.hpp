@@ -0,0 +1,116 @@
+#pragma once
+
+#include "zwidget/unit/event.hpp"
+#include "zwidget/core/keyboard_state.hpp"
+#include "application.hpp"
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+
+namespace zuu::widget {
+
+    // EventDispatcher headless - tidak ada message pump OS. Event masuk lewat
+    // push_event (dipakai Window dan HeadlessEventSource); repaint window yang
+    // ter-invalidate dijalankan saat queue kosong, sama seperti WM_PAINT.
+    class EventDispatcher {
+    private:
+        static inline std::queue<Event> event_queue_{};
+        static inline std::mutex queue_mutex_{};
+        static inline std::condition_variable queue_cv_{};
+
+        static bool try_pop(Event& out_event) {
+            {
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+                if (event_queue_.empty()) {
+                    return false;
+                }
+                out_event = event_queue_.front();
+                event_queue_.pop();
+            }
+            on_dispatch(out_event);
+            return true;
+        }
+
+        // Status keyboard ikut event yang diambil, seperti GetKeyState yang
+        // tersinkron dengan message queue Win32
+        static void on_dispatch(const Event& event) {
+            Window* window = event.get_window();
+            if (!window) return;
+            if (auto* key = event.get_if<KeyboardEvent>()) {
+                auto type = key->get_type();
+                if (type == KeyboardEvent::Type::key_press || type == KeyboardEvent::Type::key_release) {
+                    KeyboardState::apply(window, key->get_key(), type == KeyboardEvent::Type::key_press);
+                }
+            }
+            KeyboardState::activate(window);
+        }
+
+        // Didefinisikan di platform/headless/window.hpp (butuh Window lengkap)
+        static void dispatch_pending_paints();
+
+    public:
+        EventDispatcher() = default;
+        EventDispatcher(const EventDispatcher&) = delete;
+        EventDispatcher(EventDispatcher&&) = delete;
+        EventDispatcher& operator=(const EventDispatcher&) = delete;
+        EventDispatcher& operator=(EventDispatcher&&) = delete;
+        ~EventDispatcher() = default;
+
+        static void push_event(const Event& event) {
+            {
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+                event_queue_.push(event);
+            }
+            queue_cv_.notify_one();
+        }
+
+        static bool is_empty() {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            return event_queue_.empty();
+        }
+
+        static Event pop_event() {
+            Event event;
+            try_pop(event);
+            return event;
+        }
+
+        static size_t size() {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            return event_queue_.size();
+        }
+
+        static void clear() {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            std::queue<Event> empty;
+            std::swap(event_queue_, empty);
+        }
+
+        static bool PollEvent(Event& out_event) {
+            if (try_pop(out_event)) {
+                return true;
+            }
+
+            dispatch_pending_paints();
+
+            return try_pop(out_event);
+        }
+
+        static bool WaitEvent(Event& out_event) {
+            if (PollEvent(out_event)) {
+                return true;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                queue_cv_.wait(lock, [] { return !event_queue_.empty(); });
+
+                out_event = event_queue_.front();
+                event_queue_.pop();
+            }
+            on_dispatch(out_event);
+            return true;
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "window.hpp"
+
+namespace zuu::widget {
+
+    // Sumber input in-process untuk backend headless. Setiap fungsi membuat
+    // Event yang sama dengan yang dihasilkan detail::CreateEventFromMSG di
+    // Win32, lalu memasukkannya ke EventDispatcher. KeyboardState berubah
+    // saat event diambil dari queue, bukan di sini.
+    class HeadlessEventSource {
+    private:
+        static basic_point<uint16_t> to_position(const basic_point<int>& position) noexcept {
+            return basic_point<uint16_t>(
+                static_cast<uint16_t>(position.x),
+                static_cast<uint16_t>(position.y)
+            );
+        }
+
+        static void push(const Event& event) {
+            if (event.get_type() != Event::Type::none) {
+                EventDispatcher::push_event(event);
+            }
+        }
+
+    public:
+        HeadlessEventSource() = delete;
+
+        // Mouse
+        static void mouse_move(Window& window, const basic_point<int>& position) {
+            push(Event::create_mouse_event(
+                &window,
+                MouseEvent(MouseEvent::Type::move, to_position(position))
+            ));
+        }
+
+        static void mouse_down(
+            Window& window,
+            const basic_point<int>& position,
+            MouseEvent::Button button = MouseEvent::Button::left
+        ) {
+            push(Event::create_mouse_event(
+                &window,
+                MouseEvent(MouseEvent::Type::button_press, button, to_position(position))
+            ));
+        }
+
+        static void mouse_up(
+            Window& window,
+            const basic_point<int>& position,
+            MouseEvent::Button button = MouseEvent::Button::left
+        ) {
+            push(Event::create_mouse_event(
+                &window,
+                MouseEvent(MouseEvent::Type::button_release, button, to_position(position))
+            ));
+        }
+
+        static void click(
+            Window& window,
+            const basic_point<int>& position,
+            MouseEvent::Button button = MouseEvent::Button::left
+        ) {
+            mouse_down(window, position, button);
+            mouse_up(window, position, button);
+        }
+
+        // delta dalam satuan notch (sudah dibagi WHEEL_DELTA)
+        static void mouse_wheel(Window& window, int delta) {
+            push(Event::create_mouse_event(
+                &window,
+                MouseEvent(MouseEvent::Type::scroll, static_cast<uint16_t>(delta))
+            ));
+        }
+
+        // Keyboard
+        static void key_down(Window& window, KeyboardEvent::KeyCode key) {
+            push(Event::create_keyboard_event(
+                &window,
+                KeyboardEvent(KeyboardEvent::Type::key_press, key)
+            ));
+        }
+
+        static void key_up(Window& window, KeyboardEvent::KeyCode key) {
+            push(Event::create_keyboard_event(
+                &window,
+                KeyboardEvent(KeyboardEvent::Type::key_release, key)
+            ));
+        }
+
+        static void key_press(Window& window, KeyboardEvent::KeyCode key) {
+            key_down(window, key);
+            key_up(window, key);
+        }
+
+        // Window
+        static void resize(Window& window, const basic_size<int>& size) {
+            window.set_size(size);
+        }
+
+        static void focus(Window& window) {
+            window.focus();
+        }
+
+        static void close(Window& window) {
+            window.close();
+        }
+
+        static void quit() {
+            push(Event::create_quit_event());
+        }
+    };
+
+} // namespace zuu::widget
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "zwidget/graphic/software_canvas.hpp"
+#include "zwidget/graphic/batching_canvas.hpp"
+#include "zwidget/graphic/dirty_region_tracker.hpp"
+#include <memory>
+#include <vector>
+
+namespace zuu::widget {
+
+    // Renderer headless - API sama dengan Renderer Direct2D, tapi target-nya
+    // framebuffer SoftwareCanvas (offscreen surface milik virtual window).
+    class Renderer : public BatchingCanvas<SoftwareCanvas> {
+    private:
+        using Base = BatchingCanvas<SoftwareCanvas>;
+
+        struct PendingScroll {
+            basic_rect<int> area;
+            int dx, dy;
+        };
+
+        TextFormat default_text_format_;
+        DirtyRegionTracker dirty_tracker_;
+        std::vector<PendingScroll> scrolls_;
+        bool initialized_{false};
+        bool in_draw_{false};
+
+        // Blit sebelum clip damage di-push (D2D menolak copy saat ada clip).
+        // Saat full repaint blit percuma; kalau backend gagal, area di-repaint.
+        void apply_scrolls() {
+            if (scrolls_.empty()) return;
+
+            bool full = dirty_tracker_.is_full_dirty();
+            for (const auto& s : scrolls_) {
+                if (!full && !scroll_rect(s.area, s.dx, s.dy)) {
+                    dirty_tracker_.mark_dirty(s.area);
+                }
+            }
+            scrolls_.clear();
+        }
+
+    public:
+        Renderer() = default;
+        ~Renderer() = default;
+
+        Renderer(const Renderer&) = delete;
+        Renderer& operator=(const Renderer&) = delete;
+        Renderer(Renderer&&) = default;
+        Renderer& operator=(Renderer&&) = default;
+
+        // Tidak ada device/factory global di backend headless
+        static bool initialize_factories() {
+            return true;
+        }
+
+        // Initialize renderer for a virtual window
+        bool initialize(const basic_size<int>& size) {
+            SoftwareCanvas::resize(size);
+            initialized_ = true;
+            dirty_tracker_.set_bounds(basic_rect<int>(0, 0, size.w, size.h));
+            dirty_tracker_.mark_full_dirty();
+            return true;
+        }
+
+        // Resize surface (contents are lost, like a swap chain resize)
+        void resize(const basic_size<int>& new_size) {
+            if (!initialized_) return;
+            SoftwareCanvas::resize(new_size);
+            dirty_tracker_.set_bounds(basic_rect<int>(0, 0, new_size.w, new_size.h));
+            dirty_tracker_.mark_full_dirty();
+        }
+
+        // Dirty region management
+        void invalidate(const basic_rect<int>& region) {
+            dirty_tracker_.mark_dirty(region);
+        }
+
+        void invalidate_full() {
+            dirty_tracker_.mark_full_dirty();
+        }
+
+        // Scroll: konten area digeser (dx, dy) dengan blit di awal frame
+        // berikutnya, jadi yang di-repaint hanya strip yang terbuka (plus
+        // damage lama yang ikut bergeser)
+        void scroll(const basic_rect<int>& area, int dx, int dy) {
+            if (area.w <= 0 || area.h <= 0 || (dx == 0 && dy == 0)) return;
+            scrolls_.push_back(PendingScroll{area, dx, dy});
+            dirty_tracker_.scroll(area, dx, dy);
+        }
+
+        bool needs_redraw() const noexcept {
+            return dirty_tracker_.is_dirty();
+        }
+
+        // Begin/End draw cycle
+        bool begin_draw() {
+            if (!initialized_ || in_draw_) return false;
+            in_draw_ = true;
+            return true;
+        }
+
+        bool end_draw() {
+            if (!in_draw_) return false;
+            in_draw_ = false;
+            dirty_tracker_.clear();
+            return true;
+        }
+
+        template<typename DrawFunc>
+        bool render(DrawFunc&& draw_func) {
+            if (!needs_redraw()) return true;
+
+            if (!begin_draw()) return false;
+
+            apply_scrolls();
+            frame_stats_.reset();
+            set_batching(true);
+
+            // Satu traversal: widget di luar damage di-cull oleh Container,
+            // sisanya di-clip sekali ke gabungan region
+            if (dirty_tracker_.is_full_dirty()) {
+                set_damage(nullptr);
+                draw_func(*this);
+            } else {
+                const Region& damage = dirty_tracker_.get_paint_region();
+                set_damage(&damage);
+                push_clip_region(damage);
+
+                draw_func(*this);
+
+                pop_clip();
+                set_damage(nullptr);
+            }
+
+            set_batching(false);
+            return end_draw();
+        }
+
+        // Text format management
+        TextFormat* get_default_text_format() noexcept {
+            return &default_text_format_;
+        }
+
+        std::unique_ptr<TextFormat> create_text_format(
+            const std::wstring& font_family,
+            float font_size,
+            uint16_t weight = 400,
+            bool italic = false
+        ) {
+            return std::make_unique<TextFormat>(TextFormat{font_family, font_size, weight, italic});
+        }
+
+        // Override draw_text / draw_cached_text / cached_text_bounds / measure_text untuk menggunakan default text format
+        void draw_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            Base::draw_text(
+                text,
+                rect,
+                color,
+                text_format ? text_format : &default_text_format_
+            );
+        }
+
+        void draw_cached_text(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            ColorU8 color,
+            TextFormat* text_format = nullptr
+        ) override {
+            Base::draw_cached_text(
+                text,
+                rect,
+                color,
+                text_format ? text_format : &default_text_format_
+            );
+        }
+
+        basic_rect<float> cached_text_bounds(
+            const std::wstring& text,
+            const basic_rect<float>& rect,
+            TextFormat* text_format = nullptr
+        ) override {
+            return Base::cached_text_bounds(text, rect, text_format ? text_format : &default_text_format_);
+        }
+
+        TextMetrics measure_text(
+            const std::wstring& text,
+            TextFormat* text_format = nullptr,
+            std::vector<float>* advances = nullptr
+        ) override {
+            return Base::measure_text(text, text_format ? text_format : &default_text_format_, advances);
+        }
+
+        bool is_initialized() const noexcept {
+            return initialized_;
+        }
+    };
+
+} // namespace zuu::widget
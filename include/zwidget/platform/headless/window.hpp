@@ -0,0 +1,450 @@
+#pragma once
+
+#include "application.hpp"
+#include "event_dispatcher.hpp"
+#include "zwidget/graphic/renderer.hpp"
+#include "zwidget/unit/rect.hpp"
+#include <string>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace zuu::widget {
+
+    // Nilai numerik sama dengan WS_* supaya kode yang menyimpan style tetap
+    // kompatibel antar backend. Di headless style hanya memengaruhi visibilitas.
+    enum class WindowStyle : uint32_t {
+        Default         = 0x00CF0000,
+        Overlapped      = 0x00CF0000,
+        Popup           = 0x80000000,
+        Child           = 0x40000000,
+        Minimized       = 0x20000000,
+        Visible         = 0x10000000,
+        Disabled        = 0x08000000,
+        Borderless      = 0x80000000 | 0x10000000,
+        FixedSize       = 0x00C00000 | 0x00080000 | 0x00020000,
+    };
+
+    // Window headless - virtual window dengan ukuran dan offscreen surface
+    // (SoftwareCanvas di dalam Renderer). Semua operasi berjalan sinkron dan
+    // mem-push event yang sama dengan GlobalWindowProc di backend Win32.
+    class Window {
+        friend class Application;
+        friend class EventDispatcher;
+        friend class HeadlessEventSource;
+
+    public:
+        using PaintCallback = std::function<void(Renderer&)>;
+        using WindowId = Application::WindowId;
+
+    private:
+        static inline std::atomic<WindowId> focused_id_{0};
+
+        WindowId id_ = 0;
+        std::atomic<uint32_t> state_{0};
+        std::string title_;
+        basic_point<int> position_;
+        basic_size<int> size_;
+        Renderer renderer_;
+        PaintCallback paint_callback_;
+
+        void create(const basic_point<int>& position, const basic_size<int>& size, WindowStyle style) {
+            if (!Application::is_class_registered()) {
+                Application::initialize();
+            }
+
+            if (size.w < 0 || size.h < 0) {
+                throw std::runtime_error("Failed to create window");
+            }
+
+            position_ = position;
+            size_ = size;
+            id_ = Application::allocate_window_id();
+
+            set_state_flag(WindowState::Active);
+            Application::register_window(id_, this);
+            set_state_flag(WindowState::Registered);
+
+            auto bits = static_cast<uint32_t>(style);
+            if (bits & static_cast<uint32_t>(WindowStyle::Visible)) {
+                set_state_flag(WindowState::Visible);
+            }
+            if (bits & static_cast<uint32_t>(WindowStyle::Minimized)) {
+                set_state_flag(WindowState::Minimized);
+            }
+
+            // Initialize renderer
+            if (!renderer_.initialize(size)) {
+                throw std::runtime_error("Failed to initialize renderer");
+            }
+        }
+
+        void internal_destroy() noexcept {
+            if (has_state_flag(WindowState::Destroyed)) {
+                return;
+            }
+
+            WindowId id = id_;
+            if (has_state_flag(WindowState::Registered)) {
+                Application::unregister_window(id_);
+                clear_state_flag(WindowState::Registered);
+                set_state_flag(WindowState::Unregistered);
+            }
+
+            KeyboardState::forget(this);
+
+            WindowId expected = id;
+            focused_id_.compare_exchange_strong(expected, 0, std::memory_order_acq_rel);
+
+            id_ = 0;
+            set_state_flag(WindowState::Destroyed);
+
+            if (id) {
+                Application::on_window_destroyed(id);
+            }
+        }
+
+        // Thread-safe state operations
+        void set_state_flag(WindowState flag) noexcept {
+            state_.fetch_or(static_cast<uint32_t>(flag), std::memory_order_release);
+        }
+
+        void clear_state_flag(WindowState flag) noexcept {
+            state_.fetch_and(~static_cast<uint32_t>(flag), std::memory_order_release);
+        }
+
+        bool has_state_flag(WindowState flag) const noexcept {
+            uint32_t current = state_.load(std::memory_order_acquire);
+            return (current & static_cast<uint32_t>(flag)) != 0;
+        }
+
+        void push_window_event(WindowEvent::Type type) {
+            Event event = type >= WindowEvent::Type::resize
+                ? Event::create_window_event(this, WindowEvent(
+                    type,
+                    basic_size<uint16_t>(
+                        static_cast<uint16_t>(size_.w),
+                        static_cast<uint16_t>(size_.h)
+                    )
+                ))
+                : Event::create_window_event(this, WindowEvent(type));
+
+            if (event.get_type() != Event::Type::none) {
+                EventDispatcher::push_event(event);
+            }
+        }
+
+        // Pengganti WM_PAINT
+        void handle_paint() {
+            if (!renderer_.is_initialized()) return;
+
+            // Render dengan paint callback
+            if (paint_callback_) {
+                renderer_.render([this](Renderer& r) {
+                    paint_callback_(r);
+                });
+            }
+        }
+
+        bool needs_paint() const noexcept {
+            return is_valid()
+                && !has_state_flag(WindowState::Minimized)
+                && paint_callback_
+                && renderer_.needs_redraw();
+        }
+
+    public:
+        Window() = delete;
+        Window(const Window&) = delete;
+        Window& operator=(const Window&) = delete;
+
+        Window(
+            const std::string& title,
+            const basic_size<int>& size,
+            WindowStyle style = WindowStyle::Default
+        ) : state_(0), title_(title) {
+            create(basic_point<int>(0, 0), size, style);
+        }
+
+        Window(
+            const std::string& title,
+            const basic_point<int>& position,
+            const basic_size<int>& size,
+            WindowStyle style = WindowStyle::Default
+        ) : state_(0), title_(title) {
+            create(position, size, style);
+        }
+
+        Window(
+            const std::string& title,
+            const basic_rect<int>& rect,
+            WindowStyle style = WindowStyle::Default
+        ) : state_(0), title_(title) {
+            create(basic_point<int>(rect.x, rect.y), basic_size<int>(rect.w, rect.h), style);
+        }
+
+        Window(Window&& other) noexcept
+            : id_(std::exchange(other.id_, 0))
+            , state_(other.state_.exchange(0, std::memory_order_acq_rel))
+            , title_(std::move(other.title_))
+            , position_(other.position_)
+            , size_(other.size_)
+            , renderer_(std::move(other.renderer_))
+            , paint_callback_(std::move(other.paint_callback_)) {
+
+            other.set_state_flag(WindowState::Destroyed);
+            KeyboardState::forget(&other);         // Status tombol tidak ikut pindah
+            if (id_) {
+                Application::register_window(id_, this);
+            }
+        }
+
+        Window& operator=(Window&& other) noexcept {
+            if (this != &other) {
+                internal_destroy();
+
+                id_ = std::exchange(other.id_, 0);
+                state_.store(other.state_.exchange(0, std::memory_order_acq_rel),
+                           std::memory_order_release);
+                title_ = std::move(other.title_);
+                position_ = other.position_;
+                size_ = other.size_;
+                renderer_ = std::move(other.renderer_);
+                paint_callback_ = std::move(other.paint_callback_);
+
+                other.set_state_flag(WindowState::Destroyed);
+                KeyboardState::forget(&other);         // Status tombol tidak ikut pindah
+                if (id_) {
+                    Application::register_window(id_, this);
+                }
+            }
+            return *this;
+        }
+
+        ~Window() noexcept {
+            internal_destroy();
+        }
+
+        // Window operations
+        void show() {
+            if (!is_valid()) return;
+            set_state_flag(WindowState::Visible);
+            // UpdateWindow: paint langsung kalau ada area yang invalid
+            if (needs_paint()) {
+                handle_paint();
+            }
+        }
+
+        void hide() noexcept {
+            if (is_valid()) {
+                clear_state_flag(WindowState::Visible);
+            }
+        }
+
+        void minimize() {
+            if (!is_valid()) return;
+            set_state_flag(WindowState::Minimized);
+            clear_state_flag(WindowState::Maximized);
+            push_window_event(WindowEvent::Type::minimize);
+        }
+
+        void maximize() {
+            if (!is_valid()) return;
+            set_state_flag(WindowState::Maximized);
+            clear_state_flag(WindowState::Minimized);
+            push_window_event(WindowEvent::Type::maximize);
+        }
+
+        void restore() {
+            if (!is_valid()) return;
+            clear_state_flag(WindowState::Minimized);
+            clear_state_flag(WindowState::Maximized);
+            push_window_event(WindowEvent::Type::restored);
+        }
+
+        void close() {
+            if (!is_valid()) return;
+
+            set_state_flag(WindowState::CloseRequested);
+            push_window_event(WindowEvent::Type::close);
+
+            internal_destroy();
+        }
+
+        void focus() {
+            if (!is_valid()) return;
+
+            WindowId previous = focused_id_.exchange(id_, std::memory_order_acq_rel);
+            if (previous == id_) return;
+
+            if (Window* old = Application::get_window(previous)) {
+                old->clear_state_flag(WindowState::Focused);
+                old->push_window_event(WindowEvent::Type::focus_lost);
+            }
+
+            set_state_flag(WindowState::Focused);
+            push_window_event(WindowEvent::Type::focus_gained);
+        }
+
+        void set_title(const std::string& title) {
+            title_ = title;
+        }
+
+        void set_position(const basic_point<int>& position) {
+            if (is_valid()) {
+                position_ = position;
+            }
+        }
+
+        void set_size(const basic_size<int>& size) {
+            if (!is_valid() || size.w < 0 || size.h < 0) return;
+
+            size_ = size;
+            if (renderer_.is_initialized()) {
+                renderer_.resize(size);
+                invalidate();  // Force redraw after resize
+            }
+
+            clear_state_flag(WindowState::Minimized);
+            clear_state_flag(WindowState::Maximized);
+            push_window_event(WindowEvent::Type::restored);
+        }
+
+        void set_bounds(const basic_rect<int>& rect) {
+            set_position(basic_point<int>(rect.x, rect.y));
+            set_size(basic_size<int>(rect.w, rect.h));
+        }
+
+        // Rendering operations
+        void set_paint_callback(PaintCallback callback) {
+            paint_callback_ = std::move(callback);
+        }
+
+        void invalidate() {
+            renderer_.invalidate_full();
+        }
+
+        void invalidate(const basic_rect<int>& region) {
+            renderer_.invalidate(region);
+        }
+
+        // Geser konten area dengan blit; hanya strip yang terbuka di-repaint
+        void scroll(const basic_rect<int>& area, int dx, int dy) {
+            renderer_.scroll(area, dx, dy);
+        }
+
+        // Jalankan paint sekarang tanpa menunggu PollEvent/WaitEvent
+        void present() {
+            if (needs_paint()) {
+                handle_paint();
+            }
+        }
+
+        Renderer& get_renderer() noexcept {
+            return renderer_;
+        }
+
+        const Renderer& get_renderer() const noexcept {
+            return renderer_;
+        }
+
+        // Property getters
+        WindowId get_id() const noexcept {
+            return id_;
+        }
+
+        const std::string& get_title() const noexcept {
+            return title_;
+        }
+
+        WindowState get_state() const noexcept {
+            return static_cast<WindowState>(state_.load(std::memory_order_acquire));
+        }
+
+        basic_size<int> get_size() const noexcept {
+            return is_valid() ? size_ : basic_size<int>(0, 0);
+        }
+
+        basic_point<int> get_position() const noexcept {
+            return is_valid() ? position_ : basic_point<int>(0, 0);
+        }
+
+        basic_rect<int> get_client_rect() const noexcept {
+            if (is_valid()) {
+                return basic_rect<int>(0, 0, size_.w, size_.h);
+            }
+            return basic_rect<int>(0, 0, 0, 0);
+        }
+
+        basic_rect<int> get_window_rect() const noexcept {
+            if (is_valid()) {
+                return basic_rect<int>(position_.x, position_.y, size_.w, size_.h);
+            }
+            return basic_rect<int>(0, 0, 0, 0);
+        }
+
+		WindowState get_state_flags() const noexcept {
+			return static_cast<WindowState>(state_.load(std::memory_order_acquire));
+		}
+
+		bool has_any_state(WindowState flags) const noexcept {
+			return has_state_flag(flags);
+		}
+
+        bool is_valid() const noexcept {
+            return id_ && !has_state_flag(WindowState::Destroyed);
+        }
+
+        bool is_visible() const noexcept {
+            return is_valid() && has_state_flag(WindowState::Visible);
+        }
+
+        bool is_minimized() const noexcept {
+            return is_valid() && has_state_flag(WindowState::Minimized);
+        }
+
+        bool is_maximized() const noexcept {
+            return is_valid() && has_state_flag(WindowState::Maximized);
+        }
+
+        bool has_focus() const noexcept {
+            return is_valid() && has_state_flag(WindowState::Focused);
+        }
+
+        bool is_close_requested() const noexcept {
+            return has_state_flag(WindowState::CloseRequested);
+        }
+    };
+
+    inline void Application::on_window_destroyed(WindowId) {
+        if (window_count() == 0) {
+            is_running_.store(false, std::memory_order_release);
+            EventDispatcher::push_event(Event::create_quit_event());
+        }
+    }
+
+    inline void Application::shutdown() noexcept {
+        for (Window* window : get_windows()) {
+            window->internal_destroy();
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+            window_registry_.clear();
+        }
+
+        if (is_running_.exchange(false, std::memory_order_acq_rel)) {
+            EventDispatcher::push_event(Event::create_quit_event());
+        }
+    }
+
+    inline void EventDispatcher::dispatch_pending_paints() {
+        for (Window* window : Application::get_windows()) {
+            if (window->needs_paint()) {
+                window->handle_paint();
+            }
+        }
+    }
+
+} // namespace zuu::widget
@@ -11,4 +11,13 @@ namespace zuu::widget {
 		end = 1 << 2,
 	} ;
 
+	// Posisi relatif di ruang sisa: start / none = 0, center = 0.5, end = 1
+	constexpr float align_factor(QAlign align) noexcept {
+		switch (align) {
+			case QAlign::center: return 0.5f ;
+			case QAlign::end: return 1.0f ;
+			default: return 0.0f ;
+		}
+	}
+
 } // namespace zuu::widget
\ No newline at end of file
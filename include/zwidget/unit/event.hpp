@@ -1,11 +1,15 @@
 #pragma once
 
-#include <Windows.h>
-#include <Windowsx.h>
+#include "zwidget/detail/platform.hpp"
 
-#if defined(max) && defined(min)
-    #undef max
-    #undef min
+#if ZWIDGET_PLATFORM_WIN32
+    #include <Windows.h>
+    #include <Windowsx.h>
+
+    #if defined(max) && defined(min)
+        #undef max
+        #undef min
+    #endif
 #endif
 
 #include "events/window.hpp"
@@ -2,6 +2,7 @@
 
 #include "zwidget/detail/numeric.hpp"
 #include <compare>
+#include <cstdint>
 
 namespace zuu::widget {
 
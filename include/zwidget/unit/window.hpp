@@ -1,5 +1,11 @@
 #pragma once
 
+#include "zwidget/detail/platform.hpp"
+
+#if ZWIDGET_PLATFORM_HEADLESS
+    #include "zwidget/platform/headless/window.hpp"
+#else
+
 #include "zwidget/core/application.hpp"
 #include "zwidget/core/event_dispatcher.hpp"
 #include "zwidget/graphic/renderer.hpp"
@@ -359,6 +365,11 @@ namespace zuu::widget {
             renderer_.invalidate(region);
         }
 
+        // Geser konten area dengan blit; hanya strip yang terbuka di-repaint
+        void scroll(const basic_rect<int>& area, int dx, int dy) {
+            renderer_.scroll(area, dx, dy);
+        }
+
         Renderer& get_renderer() noexcept {
             return renderer_;
         }
@@ -590,4 +601,6 @@ namespace zuu::widget {
         return DefWindowProcA(hwnd, msg, wParam, lParam);
     }
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
+
+#endif // ZWIDGET_PLATFORM_HEADLESS
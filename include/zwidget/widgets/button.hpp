@@ -9,10 +9,22 @@ namespace zuu::widget {
         std::wstring text_;
         std::function<void(Button*)> on_click_;
         
-        Color normal_bg_{Color::from_hex(0x4a4a4a)};
-        Color hover_bg_{Color::from_hex(0x5a5a5a)};
-        Color pressed_bg_{Color::from_hex(0x3a3a3a)};
-        Color disabled_bg_{Color::from_hex(0x2a2a2a)};
+        ColorU8 normal_bg_{ColorU8::from_hex(0x4a4a4a)};
+        ColorU8 hover_bg_{ColorU8::from_hex(0x5a5a5a)};
+        ColorU8 pressed_bg_{ColorU8::from_hex(0x3a3a3a)};
+        ColorU8 disabled_bg_{ColorU8::from_hex(0x2a2a2a)};
+
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(text_).add(normal_bg_).add(hover_bg_).add(pressed_bg_).add(disabled_bg_);
+        }
+
+        // Background sesuai state
+        ColorU8 current_background() const noexcept {
+            if (!is_enabled()) return disabled_bg_;
+            if (is_pressed()) return pressed_bg_;
+            if (is_hovered()) return hover_bg_;
+            return normal_bg_;
+        }
 
     public:
         Button() {
@@ -25,40 +37,32 @@ namespace zuu::widget {
             text_ = text;
         }
 
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
-            // Determine background color based on state
-            Color bg_color = normal_bg_;
-            if (!is_enabled()) {
-                bg_color = disabled_bg_;
-            } else if (is_pressed()) {
-                bg_color = pressed_bg_;
-            } else if (is_hovered()) {
-                bg_color = hover_bg_;
-            }
+            ColorU8 bg_color = current_background();
 
             // Draw background
             if (style_.border_radius > 0) {
-                renderer.fill_rounded_rect(
+                canvas.fill_rounded_rect(
                     bounds_,
                     style_.border_radius,
                     style_.border_radius,
                     bg_color
                 );
             } else {
-                renderer.fill_rect(bounds_, bg_color);
+                canvas.fill_rect(bounds_, bg_color);
             }
 
             // Draw border
             if (style_.border_width > 0) {
-                Color border = style_.border_color;
+                ColorU8 border = style_.border_color;
                 if (is_focused()) {
-                    border = Color::from_hex(0x4a90e2);
+                    border = ColorU8::from_hex(0x4a90e2);
                 }
 
                 if (style_.border_radius > 0) {
-                    renderer.draw_rounded_rect(
+                    canvas.draw_rounded_rect(
                         bounds_,
                         style_.border_radius,
                         style_.border_radius,
@@ -66,23 +70,30 @@ namespace zuu::widget {
                         style_.border_width
                     );
                 } else {
-                    renderer.draw_rect(bounds_, border, style_.border_width);
+                    canvas.draw_rect(bounds_, border, style_.border_width);
                 }
             }
 
             // Draw text
             if (!text_.empty()) {
-                Color text_color = style_.text_color;
+                ColorU8 text_color = style_.text_color;
                 if (!is_enabled()) {
                     text_color = Color(0.5f, 0.5f, 0.5f, 0.5f);
                 }
 
-                renderer.draw_text(text_, content_bounds_, text_color);
+                canvas.draw_cached_text(text_, content_bounds_, text_color);
             }
 
             set_flag(WidgetFlag::Dirty, false);
         }
 
+        basic_rect<float> get_opaque_bounds() const override {
+            if (!is_visible() || style_.border_radius > 0 || !current_background().is_opaque()) {
+                return basic_rect<float>();
+            }
+            return bounds_;
+        }
+
         bool handle_mouse_down(const MouseEvent& event) override {
             if (!is_enabled()) return false;
 
@@ -152,8 +163,8 @@ namespace zuu::widget {
             on_click_ = std::move(callback);
         }
 
-        void set_colors(const Color& normal, const Color& hover, 
-                       const Color& pressed, const Color& disabled) {
+        void set_colors(ColorU8 normal, ColorU8 hover, 
+                       ColorU8 pressed, ColorU8 disabled) {
             normal_bg_ = normal;
             hover_bg_ = hover;
             pressed_bg_ = pressed;
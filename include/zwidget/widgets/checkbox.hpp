@@ -12,12 +12,33 @@ namespace zuu::widget {
         float box_size_{20.0f};
         float label_spacing_{8.0f};
         
-        Color box_color_{Color::from_hex(0x4a4a4a)};
-        Color check_color_{Color::from_hex(0x4a90e2)};
-        Color hover_color_{Color::from_hex(0x5a5a5a)};
+        ColorU8 box_color_{ColorU8::from_hex(0x4a4a4a)};
+        ColorU8 check_color_{ColorU8::from_hex(0x4a90e2)};
+        ColorU8 hover_color_{ColorU8::from_hex(0x5a5a5a)};
         
         std::function<void(CheckBox*, bool)> on_changed_;
 
+        // Check mark dalam koordinat lokal box, dibangun ulang saat ukuran berubah
+        Path check_path_;
+        float check_path_size_{0.0f};
+
+        const Path& check_path() {
+            if (check_path_size_ != box_size_) {
+                float s = box_size_;
+                check_path_.clear();
+                check_path_.move_to(s * 0.24f, s * 0.52f)
+                    .line_to(s * 0.42f, s * 0.70f)
+                    .line_to(s * 0.76f, s * 0.32f);
+                check_path_size_ = box_size_;
+            }
+            return check_path_;
+        }
+
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(label_).add(checked_).add(box_size_).add(label_spacing_)
+                .add(box_color_).add(check_color_).add(hover_color_);
+        }
+
     public:
         CheckBox() {
             set_focusable(true);
@@ -28,16 +49,16 @@ namespace zuu::widget {
             label_ = label;
         }
 
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
             float box_x = bounds_.x;
             float box_y = bounds_.y + (bounds_.h - box_size_) * 0.5f;
             
             // Draw checkbox box
-            Color bg = is_hovered() ? hover_color_ : box_color_;
+            ColorU8 bg = is_hovered() ? hover_color_ : box_color_;
             
-            renderer.fill_rounded_rect(
+            canvas.fill_rounded_rect(
                 basic_rect<float>(box_x, box_y, box_size_, box_size_),
                 3.0f, 3.0f,
                 bg
@@ -45,14 +66,14 @@ namespace zuu::widget {
 
             // Draw focus border
             if (is_focused()) {
-                renderer.draw_rounded_rect(
+                canvas.draw_rounded_rect(
                     basic_rect<float>(box_x, box_y, box_size_, box_size_),
                     3.0f, 3.0f,
-                    Color::from_hex(0x4a90e2),
+                    ColorU8::from_hex(0x4a90e2),
                     2.0f
                 );
             } else {
-                renderer.draw_rounded_rect(
+                canvas.draw_rounded_rect(
                     basic_rect<float>(box_x, box_y, box_size_, box_size_),
                     3.0f, 3.0f,
                     Color::Gray(),
@@ -62,30 +83,14 @@ namespace zuu::widget {
 
             // Draw check mark if checked
             if (checked_) {
-                float padding = box_size_ * 0.25f;
-                float check_x = box_x + padding;
-                float check_y = box_y + padding;
-                float check_size = box_size_ - padding * 2;
-                
-                // Draw checkmark (simplified X pattern)
-                renderer.draw_line(
-                    basic_point<float>(check_x, check_y),
-                    basic_point<float>(check_x + check_size, check_y + check_size),
-                    check_color_,
-                    3.0f
-                );
-                renderer.draw_line(
-                    basic_point<float>(check_x + check_size, check_y),
-                    basic_point<float>(check_x, check_y + check_size),
-                    check_color_,
-                    3.0f
-                );
+                StrokeStyle style{3.0f, LineCap::Round, LineJoin::Round};
+                canvas.stroke_path(check_path(), check_color_, style, Transform::translation(box_x, box_y));
             }
 
             // Draw label
             if (!label_.empty()) {
                 float label_x = box_x + box_size_ + label_spacing_;
-                renderer.draw_text(
+                canvas.draw_text(
                     label_,
                     basic_rect<float>(label_x, bounds_.y, 
                                      bounds_.w - box_size_ - label_spacing_, bounds_.h),
@@ -96,6 +101,11 @@ namespace zuu::widget {
             set_flag(WidgetFlag::Dirty, false);
         }
 
+        // Hanya kotak kecil + label yang digambar, bukan style background
+        basic_rect<float> get_opaque_bounds() const override {
+            return basic_rect<float>();
+        }
+
         bool handle_mouse_down(const MouseEvent& event) override {
             if (!is_enabled()) return false;
 
@@ -183,12 +193,17 @@ namespace zuu::widget {
         float circle_size_{20.0f};
         float label_spacing_{8.0f};
         
-        Color circle_color_{Color::from_hex(0x4a4a4a)};
-        Color check_color_{Color::from_hex(0x4a90e2)};
-        Color hover_color_{Color::from_hex(0x5a5a5a)};
+        ColorU8 circle_color_{ColorU8::from_hex(0x4a4a4a)};
+        ColorU8 check_color_{ColorU8::from_hex(0x4a90e2)};
+        ColorU8 hover_color_{ColorU8::from_hex(0x5a5a5a)};
         
         std::function<void(RadioButton*, bool)> on_changed_;
 
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(label_).add(checked_).add(circle_size_).add(label_spacing_)
+                .add(circle_color_).add(check_color_).add(hover_color_);
+        }
+
     public:
         RadioButton() {
             set_focusable(true);
@@ -201,16 +216,16 @@ namespace zuu::widget {
             group_name_ = group;
         }
 
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
             float circle_x = bounds_.x + circle_size_ * 0.5f;
             float circle_y = bounds_.y + bounds_.h * 0.5f;
             
             // Draw outer circle
-            Color bg = is_hovered() ? hover_color_ : circle_color_;
+            ColorU8 bg = is_hovered() ? hover_color_ : circle_color_;
             
-            renderer.fill_circle(
+            canvas.fill_circle(
                 basic_point<float>(circle_x, circle_y),
                 circle_size_ * 0.5f,
                 bg
@@ -218,14 +233,14 @@ namespace zuu::widget {
 
             // Draw focus border
             if (is_focused()) {
-                renderer.draw_circle(
+                canvas.draw_circle(
                     basic_point<float>(circle_x, circle_y),
                     circle_size_ * 0.5f,
-                    Color::from_hex(0x4a90e2),
+                    ColorU8::from_hex(0x4a90e2),
                     2.0f
                 );
             } else {
-                renderer.draw_circle(
+                canvas.draw_circle(
                     basic_point<float>(circle_x, circle_y),
                     circle_size_ * 0.5f,
                     Color::Gray(),
@@ -235,7 +250,7 @@ namespace zuu::widget {
 
             // Draw inner circle if checked
             if (checked_) {
-                renderer.fill_circle(
+                canvas.fill_circle(
                     basic_point<float>(circle_x, circle_y),
                     circle_size_ * 0.3f,
                     check_color_
@@ -245,7 +260,7 @@ namespace zuu::widget {
             // Draw label
             if (!label_.empty()) {
                 float label_x = bounds_.x + circle_size_ + label_spacing_;
-                renderer.draw_text(
+                canvas.draw_text(
                     label_,
                     basic_rect<float>(label_x, bounds_.y, 
                                      bounds_.w - circle_size_ - label_spacing_, bounds_.h),
@@ -256,6 +271,10 @@ namespace zuu::widget {
             set_flag(WidgetFlag::Dirty, false);
         }
 
+        basic_rect<float> get_opaque_bounds() const override {
+            return basic_rect<float>();
+        }
+
         bool handle_mouse_down(const MouseEvent& event) override {
             if (!is_enabled()) return false;
 
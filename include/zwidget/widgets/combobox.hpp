@@ -22,17 +22,18 @@ namespace zuu::widget {
         int selected_index_{-1};
         int hovered_index_{-1};
         float item_height_{30.0f};
+        std::vector<RectColor> item_rects_;     // Scratch batch per render
         
-        Color item_bg_normal_{Color::from_hex(0x2d2d2d)};
-        Color item_bg_hover_{Color::from_hex(0x3d3d3d)};
-        Color item_bg_selected_{Color::from_hex(0x4a90e2)};
+        ColorU8 item_bg_normal_{ColorU8::from_hex(0x2d2d2d)};
+        ColorU8 item_bg_hover_{ColorU8::from_hex(0x3d3d3d)};
+        ColorU8 item_bg_selected_{ColorU8::from_hex(0x4a90e2)};
         
         std::function<void(int)> on_item_selected_;
         
     public:
         DropdownList() {
-            style_.background_color = Color::from_hex(0x2d2d2d);
-            style_.border_color = Color::from_hex(0x4a90e2);
+            style_.background_color = ColorU8::from_hex(0x2d2d2d);
+            style_.border_color = ColorU8::from_hex(0x4a90e2);
             style_.border_width = 1.0f;
             style_.padding = {2.0f, 2.0f, 2.0f, 2.0f};
         }
@@ -60,44 +61,41 @@ namespace zuu::widget {
             set_size(basic_size<float>(bounds_.w, height));
         }
         
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
             
             // Background and border
-            renderer.fill_rect(bounds_, style_.background_color);
-            renderer.draw_rect(bounds_, style_.border_color, style_.border_width);
+            canvas.fill_rect(bounds_, style_.background_color);
+            canvas.draw_rect(bounds_, style_.border_color, style_.border_width);
             
-            // Draw items
+            // Draw items: background semua baris dalam satu batch, lalu teks
+            item_rects_.clear();
             float y = content_bounds_.y;
             
             for (size_t i = 0; i < items_.size(); ++i) {
-                basic_rect<float> item_rect(
-                    content_bounds_.x,
-                    y,
-                    content_bounds_.w,
-                    item_height_
-                );
-                
-                // Background
-                Color bg = item_bg_normal_;
+                ColorU8 bg = item_bg_normal_;
                 if (static_cast<int>(i) == selected_index_) {
                     bg = item_bg_selected_;
                 } else if (static_cast<int>(i) == hovered_index_) {
                     bg = item_bg_hover_;
                 }
-                renderer.fill_rect(item_rect, bg);
-                
-                // Text
-                Color text_color = (static_cast<int>(i) == selected_index_) 
+                item_rects_.push_back(RectColor{
+                    basic_rect<float>(content_bounds_.x, y, content_bounds_.w, item_height_),
+                    bg
+                });
+                y += item_height_;
+            }
+            canvas.fill_rects(item_rects_);
+            
+            for (size_t i = 0; i < items_.size(); ++i) {
+                ColorU8 text_color = (static_cast<int>(i) == selected_index_) 
                     ? Color::White() 
                     : Color::LightGray();
                     
-                auto text_rect = item_rect;
+                auto text_rect = item_rects_[i].rect;
                 text_rect.x += 8.0f;
                 text_rect.w -= 16.0f;
-                renderer.draw_text(items_[i].text, text_rect, text_color);
-                
-                y += item_height_;
+                canvas.draw_cached_text(items_[i].text, text_rect, text_color);
             }
             
             set_flag(WidgetFlag::Dirty, false);
@@ -170,11 +168,22 @@ namespace zuu::widget {
         std::unique_ptr<DropdownList> dropdown_;
         Window* parent_window_{nullptr};
         
-        Color button_bg_normal_{Color::from_hex(0x3a3a3a)};
-        Color button_bg_hover_{Color::from_hex(0x454545)};
-        Color arrow_color_{Color::White()};
+        ColorU8 button_bg_normal_{ColorU8::from_hex(0x3a3a3a)};
+        ColorU8 button_bg_hover_{ColorU8::from_hex(0x454545)};
+        ColorU8 arrow_color_{Color::White()};
+        Path arrow_path_;       // Chevron lokal (origin di ujung), diposisikan lewat transform
         
         std::function<void(ComboBox*, int)> on_selection_changed_;
+
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(selected_index_).add(is_open_).add(items_.size());
+            if (is_open_) {
+                // Dropdown ikut terekam: semua item terlihat
+                for (const auto& item : items_) hash.add(item.text);
+            } else if (selected_index_ >= 0 && selected_index_ < static_cast<int>(items_.size())) {
+                hash.add(items_[selected_index_].text);
+            }
+        }
         
         void open_dropdown() {
             if (is_open_ || items_.empty()) return;
@@ -190,6 +199,20 @@ namespace zuu::widget {
                     set_selected_index(index);
                     close_dropdown();
                 });
+
+                // Dropdown bukan child Container; damage-nya diteruskan lewat sini
+                dropdown_->set_damage_callback([this](const basic_rect<int>& r) {
+                    // Dropdown bagian dari cache ComboBox, tapi hover-nya tidak
+                    // ada di hash_render_state: buang rekaman, jangan replay
+                    set_flag(WidgetFlag::Dirty, true);
+                    invalidate_render_cache();
+                    invalidate_rect(basic_rect<float>(
+                        static_cast<float>(r.x),
+                        static_cast<float>(r.y),
+                        static_cast<float>(r.w),
+                        static_cast<float>(r.h)
+                    ));
+                });
             }
             
             // Position dropdown below combobox
@@ -208,6 +231,7 @@ namespace zuu::widget {
         void close_dropdown() {
             if (!is_open_) return;
             
+            invalidate_rect(get_paint_bounds());  // Termasuk area dropdown
             is_open_ = false;
             if (dropdown_) {
                 dropdown_->set_visible(false);
@@ -226,23 +250,46 @@ namespace zuu::widget {
             style_.border_color = Color::Gray();
         }
         
-        void render(Renderer& renderer) override {
+        // Dropdown digambar di bawah bounds saat terbuka
+        basic_rect<float> get_paint_bounds() const override {
+            basic_rect<float> result = Widget::get_paint_bounds();
+            if (!is_open_ || !dropdown_) return result;
+
+            basic_rect<float> d = dropdown_->get_paint_bounds();
+            float x0 = std::min(result.x, d.x);
+            float y0 = std::min(result.y, d.y);
+            float x1 = std::max(result.x + result.w, d.x + d.w);
+            float y1 = std::max(result.y + result.h, d.y + d.h);
+            return basic_rect<float>(x0, y0, x1 - x0, y1 - y0);
+        }
+
+        // Saat terbuka, dropdown (lebih besar) yang dilaporkan sebagai occluder
+        basic_rect<float> get_opaque_bounds() const override {
+            if (!is_visible()) return basic_rect<float>();
+            if (is_open_ && dropdown_) return dropdown_->get_opaque_bounds();
+
+            ColorU8 bg = is_hovered() ? button_bg_hover_ : button_bg_normal_;
+            if (style_.border_radius > 0 || !bg.is_opaque()) return basic_rect<float>();
+            return bounds_;
+        }
+
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
             
             // Button background
-            Color bg = is_hovered() ? button_bg_hover_ : button_bg_normal_;
+            ColorU8 bg = is_hovered() ? button_bg_hover_ : button_bg_normal_;
             
             if (style_.border_radius > 0) {
-                renderer.fill_rounded_rect(bounds_, style_.border_radius, style_.border_radius, bg);
+                canvas.fill_rounded_rect(bounds_, style_.border_radius, style_.border_radius, bg);
             } else {
-                renderer.fill_rect(bounds_, bg);
+                canvas.fill_rect(bounds_, bg);
             }
             
             // Border
-            Color border = is_focused() ? Color::from_hex(0x4a90e2) : style_.border_color;
+            ColorU8 border = is_focused() ? ColorU8::from_hex(0x4a90e2) : style_.border_color;
             
             if (style_.border_radius > 0) {
-                renderer.draw_rounded_rect(
+                canvas.draw_rounded_rect(
                     bounds_,
                     style_.border_radius,
                     style_.border_radius,
@@ -250,12 +297,12 @@ namespace zuu::widget {
                     style_.border_width * 2.0f
                 );
             } else {
-                renderer.draw_rect(bounds_, border, style_.border_width * 2.0f);
+                canvas.draw_rect(bounds_, border, style_.border_width * 2.0f);
             }
             
             // Selected item text
             if (selected_index_ >= 0 && selected_index_ < static_cast<int>(items_.size())) {
-                renderer.draw_text(
+                canvas.draw_cached_text(
                     items_[selected_index_].text,
                     content_bounds_,
                     style_.text_color
@@ -267,42 +314,22 @@ namespace zuu::widget {
             float arrow_y = bounds_.y + bounds_.h * 0.5f;
             float arrow_size = 6.0f;
             
-            // Draw triangle (simplified)
-            if (is_open_) {
-                // Up arrow
-                renderer.draw_line(
-                    basic_point<float>(arrow_x - arrow_size, arrow_y + arrow_size * 0.3f),
-                    basic_point<float>(arrow_x, arrow_y - arrow_size * 0.5f),
-                    arrow_color_,
-                    2.0f
-                );
-                renderer.draw_line(
-                    basic_point<float>(arrow_x, arrow_y - arrow_size * 0.5f),
-                    basic_point<float>(arrow_x + arrow_size, arrow_y + arrow_size * 0.3f),
-                    arrow_color_,
-                    2.0f
-                );
-            } else {
-                // Down arrow
-                renderer.draw_line(
-                    basic_point<float>(arrow_x - arrow_size, arrow_y - arrow_size * 0.3f),
-                    basic_point<float>(arrow_x, arrow_y + arrow_size * 0.5f),
-                    arrow_color_,
-                    2.0f
-                );
-                renderer.draw_line(
-                    basic_point<float>(arrow_x, arrow_y + arrow_size * 0.5f),
-                    basic_point<float>(arrow_x + arrow_size, arrow_y - arrow_size * 0.3f),
-                    arrow_color_,
-                    2.0f
-                );
+            // Chevron: up saat terbuka, down saat tertutup (flip vertikal)
+            float dir = is_open_ ? -1.0f : 1.0f;
+            if (arrow_path_.empty()) {
+                arrow_path_.move_to(-arrow_size, -arrow_size * 0.3f)
+                    .line_to(0.0f, arrow_size * 0.5f)
+                    .line_to(arrow_size, -arrow_size * 0.3f);
             }
+            StrokeStyle style{2.0f, LineCap::Round, LineJoin::Round};
+            Transform transform{1.0f, 0.0f, 0.0f, dir, arrow_x, arrow_y};
+            canvas.stroke_path(arrow_path_, arrow_color_, style, transform);
             
             set_flag(WidgetFlag::Dirty, false);
             
             // Render dropdown if open
             if (is_open_ && dropdown_) {
-                dropdown_->render(renderer);
+                dropdown_->render(canvas);
             }
         }
         
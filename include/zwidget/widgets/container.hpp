@@ -1,7 +1,9 @@
 #pragma once
 
 #include "widget.hpp"
+#include "zwidget/detail/occlusion_grid.hpp"
 #include <algorithm>
+#include <cmath>
 #include <memory>
 
 namespace zuu::widget {
@@ -13,6 +15,112 @@ namespace zuu::widget {
         Widget* focused_child_{nullptr};
         Widget* hovered_child_{nullptr};
 
+        // Hasil occlusion pass per child, dipakai ulang antar frame
+        enum class Coverage : uint8_t { Visible, Partial, Occluded };
+
+        struct ChildOcclusion {
+            basic_rect<float> paint;        // get_paint_bounds() child frame ini
+            Coverage coverage{Coverage::Visible};
+            uint32_t damage{0};             // Index ke occlusion_damage_ (Partial)
+            uint64_t pixels{0};             // Area damage yang dilewati (Occluded)
+        };
+
+        detail::OcclusionGrid occluders_;
+        std::vector<ChildOcclusion> occlusion_;
+        std::vector<Region> occlusion_damage_;
+        std::vector<basic_rect<int>> covering_;
+
+        static basic_rect<int> round_out(const basic_rect<float>& r) noexcept {
+            int x0 = static_cast<int>(std::floor(r.x));
+            int y0 = static_cast<int>(std::floor(r.y));
+            int x1 = static_cast<int>(std::ceil(r.x + r.w));
+            int y1 = static_cast<int>(std::ceil(r.y + r.h));
+            return basic_rect<int>(x0, y0, x1 - x0, y1 - y0);
+        }
+
+        // Hanya piksel yang sepenuhnya di dalam rect yang dijamin opaque
+        static basic_rect<int> round_in(const basic_rect<float>& r) noexcept {
+            int x0 = static_cast<int>(std::ceil(r.x));
+            int y0 = static_cast<int>(std::ceil(r.y));
+            int x1 = static_cast<int>(std::floor(r.x + r.w));
+            int y1 = static_cast<int>(std::floor(r.y + r.h));
+            return basic_rect<int>(x0, y0, std::max(0, x1 - x0), std::max(0, y1 - y0));
+        }
+
+        // Rect user -> device untuk transform axis-aligned (eksak, bukan
+        // bounding box), supaya bisa dibandingkan dengan damage
+        static basic_rect<float> to_device(const Transform& transform, const basic_rect<float>& r) noexcept {
+            if (transform.is_identity()) return r;
+            basic_point<float> a = transform.apply(basic_point<float>(r.x, r.y));
+            basic_point<float> b = transform.apply(basic_point<float>(r.x + r.w, r.y + r.h));
+            return basic_rect<float>(std::min(a.x, b.x), std::min(a.y, b.y), std::abs(b.x - a.x), std::abs(b.y - a.y));
+        }
+
+        // Sweep dari child teratas ke bawah: setiap child dibandingkan dengan
+        // occluder sibling di atasnya. Tertutup penuh (dalam damage) = dilewati;
+        // tertutup sebagian = damage yang tersisa dipakai untuk culling
+        // descendant-nya. Grid, occluder dan damage di device space; dengan
+        // rotasi / skew bounds opaque tidak lagi rect, occlusion dilewati.
+        void compute_occlusion(Canvas& canvas) {
+            const Region* damage = canvas.get_damage();
+            occlusion_.assign(children_.size(), ChildOcclusion{});
+            occlusion_damage_.clear();
+
+            // Extents grid = union paint bounds child (tanpa rekursi ulang)
+            basic_rect<float> extents = bounds_;
+            for (size_t i = 0; i < children_.size(); ++i) {
+                if (!children_[i]->is_visible()) continue;
+                auto& paint = occlusion_[i].paint;
+                paint = children_[i]->get_paint_bounds();
+                float x1 = std::max(extents.x + extents.w, paint.x + paint.w);
+                float y1 = std::max(extents.y + extents.h, paint.y + paint.h);
+                extents.x = std::min(extents.x, paint.x);
+                extents.y = std::min(extents.y, paint.y);
+                extents.w = x1 - extents.x;
+                extents.h = y1 - extents.y;
+            }
+            const Transform& transform = canvas.get_transform();
+            if (children_.size() < 2 || !transform.is_axis_aligned()) return;
+
+            occluders_.reset(round_out(to_device(transform, extents)));
+            for (size_t i = children_.size(); i-- > 0;) {
+                Widget* child = children_[i].get();
+                if (!child->is_visible()) continue;
+
+                const basic_rect<float>& paint = occlusion_[i].paint;
+                if (!occluders_.empty() && canvas.needs_paint(paint)) {
+                    basic_rect<int> box = round_out(to_device(transform, paint));
+                    covering_.clear();
+                    bool full = false;
+                    occluders_.query(box, [&](const basic_rect<int>& r) {
+                        covering_.push_back(r);
+                        full = full || (r.x <= box.x && r.y <= box.y &&
+                                        r.x + r.w >= box.x + box.w && r.y + r.h >= box.y + box.h);
+                    });
+
+                    if (!covering_.empty()) {
+                        Region remaining(box);
+                        if (damage) remaining.intersect(*damage);
+                        int64_t area = remaining.area();
+                        if (!full) remaining.subtract(Region::from_rects(covering_));
+
+                        auto& result = occlusion_[i];
+                        if (full || remaining.is_empty()) {
+                            result.coverage = Coverage::Occluded;
+                            result.pixels = static_cast<uint64_t>(area);
+                        } else if (dynamic_cast<Container*>(child)) {
+                            // Damage hanya dipakai Container untuk culling child-nya
+                            result.coverage = Coverage::Partial;
+                            result.damage = static_cast<uint32_t>(occlusion_damage_.size());
+                            occlusion_damage_.push_back(std::move(remaining));
+                        }
+                    }
+                }
+
+                occluders_.add(round_in(to_device(transform, child->get_opaque_bounds())));
+            }
+        }
+
     public:
         Container() = default;
         virtual ~Container() = default;
@@ -98,18 +206,70 @@ namespace zuu::widget {
         }
 
         // Rendering
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
             // Render self
-            Widget::render(renderer);
+            Widget::render(canvas);
+
+            // Render children; yang tidak menyentuh damage frame ini atau
+            // tertutup sibling opaque di atasnya dilewati
+            compute_occlusion(canvas);
+
+            auto& stats = canvas.get_frame_stats();
+            const Region* damage = canvas.get_damage();
+            for (size_t i = 0; i < children_.size(); ++i) {
+                Widget* child = children_[i].get();
+                if (!child->is_visible()) continue;
+
+                const auto& occlusion = occlusion_[i];
+                ++stats.widgets_visited;
+                if (!canvas.needs_paint(occlusion.paint)) continue;
+
+                if (occlusion.coverage == Coverage::Occluded) {
+                    ++stats.widgets_occluded;
+                    stats.occluded_pixels += occlusion.pixels;
+                    continue;
+                }
 
-            // Render children
-            for (auto& child : children_) {
-                child->render(renderer);
+                ++stats.widgets_drawn;
+                if (occlusion.coverage == Coverage::Partial) {
+                    canvas.set_damage(&occlusion_damage_[occlusion.damage]);
+                    child->paint(canvas);
+                    canvas.set_damage(damage);
+                } else {
+                    child->paint(canvas);
+                }
             }
         }
 
+        // Children di-cache masing-masing; cache container sendiri akan
+        // invalid setiap kali ada descendant yang berubah
+        bool is_render_cacheable() const noexcept override {
+            return false;
+        }
+
+        // Children tidak di-clip ke bounds container, jadi paint bounds
+        // mencakup child yang menggambar keluar (mis. dropdown ComboBox)
+        basic_rect<float> get_paint_bounds() const override {
+            basic_rect<float> result = Widget::get_paint_bounds();
+            float x1 = result.x + result.w;
+            float y1 = result.y + result.h;
+
+            for (const auto& child : children_) {
+                if (!child->is_visible()) continue;
+                basic_rect<float> b = child->get_paint_bounds();
+                result.x = std::min(result.x, b.x);
+                result.y = std::min(result.y, b.y);
+                x1 = std::max(x1, b.x + b.w);
+                y1 = std::max(y1, b.y + b.h);
+            }
+
+            result.w = x1 - result.x;
+            result.h = y1 - result.y;
+            return result;
+        }
+
         // Update
         void update(float dt) override {
             Widget::update(dt);
@@ -244,4 +404,44 @@ namespace zuu::widget {
         }
     };
 
+    inline Widget* Widget::get_root() noexcept {
+        Widget* widget = this;
+        while (widget->parent_) {
+            widget = widget->parent_;
+        }
+        return widget;
+    }
+
+    inline void Widget::invalidate_rect(const basic_rect<float>& rect) {
+        Widget* widget = this;
+        while (widget->parent_) {
+            widget = widget->parent_;
+            widget->set_flag(WidgetFlag::Dirty, true);
+        }
+        if (!widget->damage_callback_ || rect.w <= 0 || rect.h <= 0) return;
+
+        // Bulatkan keluar supaya piksel AA di tepi ikut ter-repaint
+        int x0 = static_cast<int>(std::floor(rect.x));
+        int y0 = static_cast<int>(std::floor(rect.y));
+        int x1 = static_cast<int>(std::ceil(rect.x + rect.w));
+        int y1 = static_cast<int>(std::ceil(rect.y + rect.h));
+        widget->damage_callback_(basic_rect<int>(x0, y0, x1 - x0, y1 - y0));
+    }
+
+    inline void Widget::mark_dirty() {
+        set_flag(WidgetFlag::Dirty, true);
+        if (!is_visible()) return;
+
+        // Paint bounds Container menyapu semua child, jadi hanya dihitung
+        // kalau memang ada yang menerima damage
+        Widget* root = get_root();
+        if (!root->damage_callback_) {
+            for (Widget* w = parent_; w; w = w->parent_) {
+                w->set_flag(WidgetFlag::Dirty, true);
+            }
+            return;
+        }
+        invalidate_rect(get_paint_bounds());
+    }
+
 } // namespace zuu::widget
\ No newline at end of file
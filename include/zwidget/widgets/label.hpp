@@ -1,7 +1,9 @@
 #pragma once
 
 #include "widget.hpp"
+#include "zwidget/graphic/line_breaker.hpp"
 #include "zwidget/unit/align.hpp"
+#include <limits>
 
 namespace zuu::widget {
 
@@ -12,6 +14,36 @@ namespace zuu::widget {
         QAlign v_align_{QAlign::center};
         bool word_wrap_{false};
 
+        // Teks diukur + dipindai break opportunity sekali per set_text;
+        // resize hanya re-flow baris (LineBreaker::wrap) kalau lebar berubah
+        LineBreaker breaker_;
+        std::vector<float> advances_;
+        std::vector<std::wstring> lines_;           // Teks per baris hasil wrap terakhir
+        float line_height_{0.0f};
+        bool measured_{false};
+
+        void reflow(Canvas& canvas) {
+            if (!measured_) {
+                line_height_ = canvas.measure_text(text_, nullptr, &advances_).line_height;
+                breaker_.set_text(text_, advances_);
+                measured_ = true;
+            }
+
+            // Tanpa word wrap baris hanya putus di '\n'
+            float width = word_wrap_ ? content_bounds_.w : std::numeric_limits<float>::infinity();
+            if (!breaker_.wrap(width)) return;
+
+            const auto& lines = breaker_.lines();
+            lines_.resize(lines.size());
+            for (size_t i = 0; i < lines.size(); ++i) {
+                lines_[i].assign(text_, lines[i].begin, lines[i].end - lines[i].begin);
+            }
+        }
+
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(text_).add(h_align_).add(v_align_).add(word_wrap_);
+        }
+
     public:
         Label() {
             style_.background_color = Color::Transparent();
@@ -22,19 +54,29 @@ namespace zuu::widget {
             text_ = text;
         }
 
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
             // Draw background if not transparent
             if (style_.background_color.a() > 0) {
-                Widget::render(renderer);
+                Widget::render(canvas);
             }
 
-            // Draw text
+            // Alignment diterapkan ke line box hasil wrap; box tiap baris
+            // selebar barisnya (+1px toleransi) supaya backend tidak wrap ulang
             if (!text_.empty()) {
-                // TODO: Implement proper text alignment
-                // For now, just draw in content bounds
-                renderer.draw_text(text_, content_bounds_, style_.text_color);
+                reflow(canvas);
+                const auto& lines = breaker_.lines();
+                float total = static_cast<float>(lines.size()) * line_height_;
+                float y = content_bounds_.y + (content_bounds_.h - total) * align_factor(v_align_);
+                float h_factor = align_factor(h_align_);
+
+                for (size_t i = 0; i < lines.size(); ++i, y += line_height_) {
+                    if (lines_[i].empty()) continue;
+                    float x = content_bounds_.x + (content_bounds_.w - lines[i].width) * h_factor;
+                    canvas.draw_cached_text(lines_[i],
+                        basic_rect<float>(x, y, lines[i].width + 1.0f, line_height_), style_.text_color);
+                }
             }
 
             set_flag(WidgetFlag::Dirty, false);
@@ -44,6 +86,7 @@ namespace zuu::widget {
         void set_text(const std::wstring& text) {
             if (text_ != text) {
                 text_ = text;
+                measured_ = false;
                 mark_dirty();
             }
         }
@@ -70,7 +113,7 @@ namespace zuu::widget {
             }
         }
 
-        void set_text_color(const Color& color) {
+        void set_text_color(ColorU8 color) {
             style_.text_color = color;
             mark_dirty();
         }
@@ -14,8 +14,8 @@ namespace zuu::widget {
     class Panel : public Container {
     public:
         Panel() {
-            style_.background_color = Color::from_hex(0x2d2d2d);
-            style_.border_color = Color::from_hex(0x3d3d3d);
+            style_.background_color = ColorU8::from_hex(0x2d2d2d);
+            style_.border_color = ColorU8::from_hex(0x3d3d3d);
             style_.border_width = 1.0f;
         }
     };
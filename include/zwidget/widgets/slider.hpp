@@ -23,14 +23,20 @@ namespace zuu::widget {
         float track_thickness_{4.0f};
         float thumb_size_{16.0f};
         
-        Color track_color_{Color::from_hex(0x4a4a4a)};
-        Color track_fill_color_{Color::from_hex(0x4a90e2)};
-        Color thumb_color_{Color::from_hex(0xffffff)};
-        Color thumb_hover_color_{Color::from_hex(0xe0e0e0)};
-        Color thumb_active_color_{Color::from_hex(0xc0c0c0)};
+        ColorU8 track_color_{ColorU8::from_hex(0x4a4a4a)};
+        ColorU8 track_fill_color_{ColorU8::from_hex(0x4a90e2)};
+        ColorU8 thumb_color_{ColorU8::from_hex(0xffffff)};
+        ColorU8 thumb_hover_color_{ColorU8::from_hex(0xe0e0e0)};
+        ColorU8 thumb_active_color_{ColorU8::from_hex(0xc0c0c0)};
         
         bool is_dragging_{false};
         std::function<void(Slider*, float)> on_value_changed_;
+
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(min_value_).add(max_value_).add(current_value_).add(orientation_)
+                .add(track_thickness_).add(thumb_size_).add(is_dragging_)
+                .add(track_color_).add(track_fill_color_).add(thumb_color_);
+        }
         
         float get_normalized_value() const {
             if (max_value_ <= min_value_) return 0.0f;
@@ -105,23 +111,23 @@ namespace zuu::widget {
         Slider() {
 			set_focusable(true);
 			style_.padding = {8.0f, 8.0f, 8.0f, 8.0f};
-			style_.background_color = Color::from_hex(0x2d2d2d);
+			style_.background_color = ColorU8::from_hex(0x2d2d2d);
 			style_.border_width = 1.0f;
-			style_.border_color = Color::from_hex(0x3d3d3d);
+			style_.border_color = ColorU8::from_hex(0x3d3d3d);
 		}
         
         explicit Slider(SliderOrientation orientation) : Slider() {
             orientation_ = orientation;
         }
         
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
 			if (!is_visible()) return;
 			
 			if (style_.background_color.a() > 0) {
-				renderer.fill_rect(bounds_, style_.background_color);
+				canvas.fill_rect(bounds_, style_.background_color);
 			}
 			if (style_.border_width > 0) {
-				renderer.draw_rect(bounds_, style_.border_color, style_.border_width);
+				canvas.draw_rect(bounds_, style_.border_color, style_.border_width);
 			}
 			
 			// Calculate track rect
@@ -145,11 +151,11 @@ namespace zuu::widget {
 			}
 			
 			// PERBAIKAN: Pastikan track visible dengan warna yang kontras
-			renderer.fill_rounded_rect(
+			canvas.fill_rounded_rect(
 				track_rect,
 				track_thickness_ * 0.5f,
 				track_thickness_ * 0.5f,
-				Color::from_hex(0x505050)  // Lebih terang
+				ColorU8::from_hex(0x505050)  // Lebih terang
 			);
 			
 			// Draw filled portion
@@ -163,7 +169,7 @@ namespace zuu::widget {
 			}
 			
 			if (fill_rect.w > 0 && fill_rect.h > 0) {
-				renderer.fill_rounded_rect(
+				canvas.fill_rounded_rect(
 					fill_rect,
 					track_thickness_ * 0.5f,
 					track_thickness_ * 0.5f,
@@ -173,7 +179,7 @@ namespace zuu::widget {
 			
 			// Draw thumb
 			auto thumb_rect = get_thumb_rect();
-			Color thumb_color = thumb_color_;
+			ColorU8 thumb_color = thumb_color_;
 			
 			if (!is_enabled()) {
 				thumb_color = Color(0.5f, 0.5f, 0.5f, 0.5f);
@@ -183,7 +189,7 @@ namespace zuu::widget {
 				thumb_color = thumb_hover_color_;
 			}
 			
-			renderer.fill_circle(
+			canvas.fill_circle(
 				basic_point<float>(
 					thumb_rect.x + thumb_rect.w * 0.5f,
 					thumb_rect.y + thumb_rect.h * 0.5f
@@ -194,13 +200,13 @@ namespace zuu::widget {
 			
 			// Draw focus indicator
 			if (is_focused()) {
-				renderer.draw_circle(
+				canvas.draw_circle(
 					basic_point<float>(
 						thumb_rect.x + thumb_rect.w * 0.5f,
 						thumb_rect.y + thumb_rect.h * 0.5f
 					),
 					thumb_size_ * 0.5f + 2.0f,
-					Color::from_hex(0x4a90e2),
+					ColorU8::from_hex(0x4a90e2),
 					2.0f
 				);
 			}
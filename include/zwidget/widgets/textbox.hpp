@@ -1,6 +1,7 @@
 #pragma once
 
 #include "widget.hpp"
+#include "zwidget/core/keyboard_state.hpp"
 
 namespace zuu::widget {
 
@@ -20,19 +21,96 @@ namespace zuu::widget {
         float cursor_blink_time_{0.0f};
         bool cursor_visible_{true};
         float scroll_offset_{0.0f};  // For horizontal scrolling
+
+        // Advance per code unit teks tampilan dan prefix sum-nya: carets_[i]
+        // = x caret sebelum unit i, relatif awal teks. Edit hanya menandai
+        // rentang [measure_begin_, measure_end_) untuk diukur ulang di
+        // render berikutnya (plus satu unit di kiri untuk kerning).
+        std::vector<float> advances_;
+        std::vector<float> carets_{0.0f};
+        std::vector<float> measure_scratch_;
+        size_t measure_begin_{0};
+        size_t measure_end_{0};
+        bool measure_pending_{false};
+        bool measure_all_{true};
         
-        Color background_normal_{Color::from_hex(0x3a3a3a)};
-        Color background_focused_{Color::from_hex(0x454545)};
-        Color selection_color_{Color::from_hex(0x4a90e2)};
-        Color cursor_color_{Color::White()};
+        ColorU8 background_normal_{ColorU8::from_hex(0x3a3a3a)};
+        ColorU8 background_focused_{ColorU8::from_hex(0x454545)};
+        ColorU8 selection_color_{ColorU8::from_hex(0x4a90e2)};
+        ColorU8 cursor_color_{Color::White()};
         
         std::function<void(TextBox*, const std::wstring&)> on_text_changed_;
         std::function<void(TextBox*)> on_enter_pressed_;
 
+        void hash_render_state(detail::StateHasher& hash) const override {
+            hash.add(text_).add(placeholder_).add(cursor_position_)
+                .add(selection_start_).add(selection_end_).add(is_password_)
+                .add(cursor_visible_).add(scroll_offset_);
+        }
+
         void clamp_cursor() {
             cursor_position_ = std::min(cursor_position_, text_.length());
         }
 
+        // [pos, pos + removed) diganti inserted unit baru
+        void text_edited(size_t pos, size_t removed, size_t inserted) {
+            if (measure_all_) return;
+            auto at = advances_.begin() + static_cast<std::ptrdiff_t>(pos);
+            at = advances_.erase(at, at + static_cast<std::ptrdiff_t>(removed));
+            advances_.insert(at, inserted, 0.0f);
+
+            if (!measure_pending_) {
+                measure_begin_ = pos;
+                measure_end_ = pos + inserted;
+                measure_pending_ = true;
+                return;
+            }
+            auto shift = [&](size_t p) {
+                if (p <= pos) return p;
+                return p >= pos + removed ? p - removed + inserted : pos + inserted;
+            };
+            measure_begin_ = std::min(shift(measure_begin_), pos);
+            measure_end_ = std::max(shift(measure_end_), pos + inserted);
+        }
+
+        // Ukur ulang rentang yang diedit (atau semua), lalu prefix sum dari
+        // unit pertama yang berubah
+        void update_carets(Canvas& canvas, const std::wstring& display) {
+            size_t from = 0;
+            if (measure_all_ || advances_.size() != display.size()) {
+                canvas.measure_text(display, nullptr, &advances_);
+                measure_all_ = false;
+            } else if (measure_pending_) {
+                // Substring harus mulai dan berakhir di batas glyph / cluster:
+                // low surrogate atau ekor cluster (advance 0) yang diukur
+                // sendirian dapat advance .notdef
+                auto tail = [&](size_t i) {
+                    return (display[i] >= 0xDC00 && display[i] < 0xE000) || advances_[i] == 0.0f;
+                };
+                size_t end = std::min(measure_end_, display.size());
+                from = std::min(measure_begin_, end);
+                if (from > 0) --from;
+                while (from > 0 && tail(from)) --from;
+                size_t to = std::min(end + 1, display.size());
+                while (to < display.size() && tail(to)) ++to;
+                canvas.measure_text(display.substr(from, to - from), nullptr, &measure_scratch_);
+
+                // Unit terakhir substring belum kena kerning ke kanannya
+                size_t keep = (to == display.size() ? to : end) - from;
+                keep = std::min(keep, measure_scratch_.size());
+                std::copy_n(measure_scratch_.begin(), keep, advances_.begin() + static_cast<std::ptrdiff_t>(from));
+            } else if (carets_.size() == display.size() + 1) {
+                return;
+            }
+            measure_pending_ = false;
+
+            carets_.resize(display.size() + 1);
+            carets_[0] = 0.0f;
+            for (size_t i = from; i < display.size(); ++i) {
+                carets_[i + 1] = carets_[i] + advances_[i];
+            }
+        }
+
         void delete_selection() {
             if (!has_selection()) return;
             
@@ -40,6 +118,7 @@ namespace zuu::widget {
             size_t end = std::max(selection_start_, selection_end_);
             
             text_.erase(start, end - start);
+            text_edited(start, end - start, 0);
             cursor_position_ = start;
             clear_selection();
             
@@ -78,6 +157,7 @@ namespace zuu::widget {
             }
             
             text_.insert(cursor_position_, 1, ch);
+            text_edited(cursor_position_, 0, 1);
             cursor_position_++;
             
             if (on_text_changed_) {
@@ -86,6 +166,7 @@ namespace zuu::widget {
         }
         
         wchar_t vk_to_char(KeyboardEvent::KeyCode key, bool shift) {
+#if ZWIDGET_PLATFORM_WIN32
 			UINT vk = static_cast<UINT>(key);
 			
 			// Handle alphanumeric dengan MapVirtualKey
@@ -101,6 +182,13 @@ namespace zuu::widget {
 					return buffer[0];
 				}
 			}
+#else
+			// Tanpa layout keyboard OS: A-Z langsung dari key code (layout US)
+			if (key >= KeyboardEvent::KeyCode::A && key <= KeyboardEvent::KeyCode::Z) {
+				wchar_t upper = static_cast<wchar_t>(key);
+				return shift ? upper : static_cast<wchar_t>(upper - L'A' + L'a');
+			}
+#endif
 			
 			// Special characters dengan shift
 			if (shift) {
@@ -134,11 +222,11 @@ namespace zuu::widget {
 		}
         
         bool is_shift_pressed() const {
-            return (GetKeyState(VK_SHIFT) & 0x8000) != 0;
+            return KeyboardState::is_shift_down();
         }
         
         bool is_ctrl_pressed() const {
-            return (GetKeyState(VK_CONTROL) & 0x8000) != 0;
+            return KeyboardState::is_control_down();
         }
 
     public:
@@ -151,23 +239,23 @@ namespace zuu::widget {
             style_.border_color = Color::Gray();
         }
 
-        void render(Renderer& renderer) override {
+        void render(Canvas& canvas) override {
             if (!is_visible()) return;
 
             // Background
-            Color bg = is_focused() ? background_focused_ : background_normal_;
+            ColorU8 bg = is_focused() ? background_focused_ : background_normal_;
             
             if (style_.border_radius > 0) {
-                renderer.fill_rounded_rect(bounds_, style_.border_radius, style_.border_radius, bg);
+                canvas.fill_rounded_rect(bounds_, style_.border_radius, style_.border_radius, bg);
             } else {
-                renderer.fill_rect(bounds_, bg);
+                canvas.fill_rect(bounds_, bg);
             }
 
             // Border
-            Color border = is_focused() ? Color::from_hex(0x4a90e2) : style_.border_color;
+            ColorU8 border = is_focused() ? ColorU8::from_hex(0x4a90e2) : style_.border_color;
             
             if (style_.border_radius > 0) {
-                renderer.draw_rounded_rect(
+                canvas.draw_rounded_rect(
                     bounds_,
                     style_.border_radius,
                     style_.border_radius,
@@ -175,33 +263,35 @@ namespace zuu::widget {
                     style_.border_width * 2.0f
                 );
             } else {
-                renderer.draw_rect(bounds_, border, style_.border_width * 2.0f);
+                canvas.draw_rect(bounds_, border, style_.border_width * 2.0f);
             }
 
             // Clip to content area
-            renderer.push_clip(content_bounds_);
+            canvas.push_clip(content_bounds_);
+
+            std::wstring display_text = get_display_text();
+            update_carets(canvas, display_text);
 
             // Draw selection
             if (has_selection() && is_focused()) {
-                size_t start = std::min(selection_start_, selection_end_);
-                size_t end = std::max(selection_start_, selection_end_);
-                
-                // Rough character width estimation (should use proper text measurement)
-                float char_width = 8.0f;
-                float sel_x = content_bounds_.x + start * char_width - scroll_offset_;
-                float sel_w = (end - start) * char_width;
+                size_t start = std::min(selection_start_, text_.length());
+                size_t end = std::min(selection_end_, text_.length());
+                if (start > end) std::swap(start, end);
+
+                float sel_x = content_bounds_.x + carets_[start] - scroll_offset_;
+                float sel_w = carets_[end] - carets_[start];
                 
-                renderer.fill_rect(
+                Color selection = selection_color_.to_color();
+                selection.set_a(0.3f);
+                canvas.fill_rect(
                     basic_rect<float>(sel_x, content_bounds_.y, sel_w, content_bounds_.h),
-                    Color(selection_color_.r(), selection_color_.g(), selection_color_.b(), 0.3f)
+                    selection
                 );
             }
 
             // Draw text or placeholder
-            std::wstring display_text = get_display_text();
-            
             if (display_text.empty() && !placeholder_.empty() && !is_focused()) {
-                renderer.draw_text(
+                canvas.draw_text(
                     placeholder_,
                     content_bounds_,
                     Color(0.5f, 0.5f, 0.5f, 0.7f)
@@ -210,13 +300,12 @@ namespace zuu::widget {
                 // Apply scroll offset for horizontal scrolling
                 auto text_rect = content_bounds_;
                 text_rect.x -= scroll_offset_;
-                renderer.draw_text(display_text, text_rect, style_.text_color);
+                canvas.draw_text(display_text, text_rect, style_.text_color);
             }
 
             // Draw cursor
             if (is_focused() && cursor_visible_ && !has_selection()) {
-                float char_width = 8.0f;
-                float cursor_x = content_bounds_.x + cursor_position_ * char_width - scroll_offset_;
+                float cursor_x = content_bounds_.x + carets_[std::min(cursor_position_, carets_.size() - 1)] - scroll_offset_;
                 
                 // Auto-scroll to keep cursor visible
                 if (cursor_x < content_bounds_.x) {
@@ -225,7 +314,7 @@ namespace zuu::widget {
                     scroll_offset_ += (cursor_x - (content_bounds_.x + content_bounds_.w));
                 }
                 
-                renderer.draw_line(
+                canvas.draw_line(
                     basic_point<float>(cursor_x, content_bounds_.y + 2),
                     basic_point<float>(cursor_x, content_bounds_.y + content_bounds_.h - 2),
                     cursor_color_,
@@ -233,10 +322,18 @@ namespace zuu::widget {
                 );
             }
 
-            renderer.pop_clip();
+            canvas.pop_clip();
             set_flag(WidgetFlag::Dirty, false);
         }
 
+        basic_rect<float> get_opaque_bounds() const override {
+            ColorU8 bg = is_focused() ? background_focused_ : background_normal_;
+            if (!is_visible() || style_.border_radius > 0 || !bg.is_opaque()) {
+                return basic_rect<float>();
+            }
+            return bounds_;
+        }
+
         void update(float dt) override {
             Widget::update(dt);
             
@@ -254,11 +351,9 @@ namespace zuu::widget {
             if (!is_enabled()) return false;
 
             if (event.get_button() == MouseEvent::Button::left) {
-                // TODO: Calculate actual cursor position from click
-                // For now, simple implementation
-                float char_width = 8.0f;
+                // Caret terdekat dari prefix sum hasil render terakhir
                 float click_x = static_cast<float>(event.get_position().x) - content_bounds_.x + scroll_offset_;
-                cursor_position_ = static_cast<size_t>(std::max(0.0f, click_x / char_width));
+                cursor_position_ = hit_test_carets(carets_, click_x).position;
                 clamp_cursor();
                 
                 if (!is_shift_pressed()) {
@@ -350,6 +445,7 @@ namespace zuu::widget {
 						delete_selection();
 					} else if (cursor_position_ > 0) {
 						text_.erase(cursor_position_ - 1, 1);
+						text_edited(cursor_position_ - 1, 1, 0);
 						cursor_position_--;
 						if (on_text_changed_) {
 							on_text_changed_(this, text_);
@@ -364,6 +460,7 @@ namespace zuu::widget {
 						delete_selection();
 					} else if (cursor_position_ < text_.length()) {
 						text_.erase(cursor_position_, 1);
+						text_edited(cursor_position_, 1, 0);
 						if (on_text_changed_) {
 							on_text_changed_(this, text_);
 						}
@@ -397,6 +494,7 @@ namespace zuu::widget {
         void set_text(const std::wstring& text) {
             if (text_ != text) {
                 text_ = text.substr(0, max_length_);
+                measure_all_ = true;
                 cursor_position_ = text_.length();
                 clamp_cursor();
                 clear_selection();
@@ -418,6 +516,7 @@ namespace zuu::widget {
         void set_password_mode(bool enabled) {
             if (is_password_ != enabled) {
                 is_password_ = enabled;
+                measure_all_ = true;
                 mark_dirty();
             }
         }
@@ -426,6 +525,7 @@ namespace zuu::widget {
             max_length_ = max_length;
             if (text_.length() > max_length_) {
                 text_.resize(max_length_);
+                measure_all_ = true;
                 clamp_cursor();
                 mark_dirty();
             }
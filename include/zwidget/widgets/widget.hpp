@@ -2,7 +2,10 @@
 
 #include "zwidget/unit/rect.hpp"
 #include "zwidget/unit/event.hpp"
-#include "zwidget/graphic/renderer.hpp"
+#include "zwidget/graphic/canvas.hpp"
+#include "zwidget/graphic/display_list.hpp"
+#include "zwidget/graphic/layer_cache.hpp"
+#include "zwidget/detail/hash.hpp"
 #include <string>
 #include <functional>
 
@@ -23,6 +26,7 @@ namespace zuu::widget {
         Pressed         = 1 << 5,
         Dirty           = 1 << 6,  // Needs redraw
         LayoutDirty     = 1 << 7,  // Needs layout recalc
+        CacheAsLayer    = 1 << 8,  // Subtree di-render ke bitmap offscreen (LayerCache)
     };
 
     constexpr WidgetFlag operator|(WidgetFlag a, WidgetFlag b) noexcept {
@@ -39,9 +43,9 @@ namespace zuu::widget {
 
     // Widget style
     struct WidgetStyle {
-        Color background_color{Color::Transparent()};
-        Color border_color{Color::Gray()};
-        Color text_color{Color::from_hex(0xecf0f1)}; // Off-white untuk kontras baik
+        ColorU8 background_color{Color::Transparent()};
+        ColorU8 border_color{Color::Gray()};
+        ColorU8 text_color{ColorU8::from_hex(0xecf0f1)}; // Off-white untuk kontras baik
         
         float border_width{1.0f};
         float border_radius{0.0f};
@@ -61,6 +65,9 @@ namespace zuu::widget {
         } margin;
     };
 
+    // Penerima damage di root widget tree (biasanya Window::invalidate)
+    using DamageCallback = std::function<void(const basic_rect<int>&)>;
+
     // Base Widget class
     class Widget {
     protected:
@@ -82,6 +89,16 @@ namespace zuu::widget {
         std::function<void(Widget*)> on_focus_gained_;
         std::function<void(Widget*)> on_focus_lost_;
 
+        // Hanya dipakai root; widget lain meneruskan damage lewat parent_
+        DamageCallback damage_callback_;
+
+        // Command stream hasil render() terakhir, valid selama widget tidak
+        // Dirty dan hash state render-nya sama
+        DisplayList render_cache_;
+        uint64_t render_cache_key_{0};
+        bool render_cache_valid_{false};
+        bool render_cache_enabled_{true};
+
         void set_flag(WidgetFlag flag, bool value = true) noexcept {
             if (value) {
                 flags_ = flags_ | flag;
@@ -92,10 +109,52 @@ namespace zuu::widget {
             }
         }
 
-        void mark_dirty() {
-            set_flag(WidgetFlag::Dirty, true);
-            if (parent_) {
-                // Propagate to parent - implemented in container.hpp
+        // Set Dirty dan kirim paint bounds widget ke root sebagai damage.
+        // mark_dirty / invalidate_rect didefinisikan di container.hpp karena
+        // butuh Container lengkap untuk naik lewat parent_.
+        void mark_dirty();
+
+        // Kirim rect (koordinat absolut) ke DamageCallback milik root
+        void invalidate_rect(const basic_rect<float>& rect);
+
+        // State spesifik widget yang memengaruhi render (teks, value, ...).
+        // Bounds, flags dan style sudah di-hash oleh render_state_hash().
+        virtual void hash_render_state(detail::StateHasher&) const {}
+
+        // Subtree dirender sekali ke layer seukuran paint bounds, lalu tiap
+        // frame cukup satu blit sampai ada descendant yang Dirty (invalidate_rect
+        // menandai semua ancestor) atau bounds berubah
+        void paint_layer(Canvas& canvas) {
+            basic_rect<float> paint = get_paint_bounds();
+            int x0 = static_cast<int>(std::floor(paint.x));
+            int y0 = static_cast<int>(std::floor(paint.y));
+            int x1 = static_cast<int>(std::ceil(paint.x + paint.w));
+            int y1 = static_cast<int>(std::ceil(paint.y + paint.h));
+            basic_rect<int> bounds(x0, y0, x1 - x0, y1 - y0);
+
+            auto& cache = LayerCache::global();
+            auto& stats = canvas.get_frame_stats();
+
+            std::shared_ptr<Canvas> layer;
+            if (!is_dirty()) {
+                layer = cache.find(this, canvas.layer_device(), bounds);
+            }
+            if (layer) {
+                ++stats.layer_cache_hits;
+            } else {
+                auto fresh = canvas.create_layer(bounds);
+                if (!fresh) {
+                    cache.release(this);
+                    render(canvas);
+                    return;
+                }
+                ++stats.layer_cache_misses;
+                render(*fresh);
+                layer = cache.insert(this, canvas.layer_device(), bounds, std::move(fresh));
+            }
+
+            if (!canvas.draw_layer(*layer, bounds)) {
+                render(canvas);
             }
         }
 
@@ -110,7 +169,11 @@ namespace zuu::widget {
 
     public:
         Widget() = default;
-        virtual ~Widget() = default;
+        virtual ~Widget() {
+            if (is_cached_as_layer()) {
+                LayerCache::global().release(this);
+            }
+        }
 
         Widget(const Widget&) = delete;
         Widget& operator=(const Widget&) = delete;
@@ -118,27 +181,27 @@ namespace zuu::widget {
         Widget& operator=(Widget&&) = default;
 
         // Core virtual methods
-        virtual void render(Renderer& renderer) {
+        virtual void render(Canvas& canvas) {
             if (!is_visible()) return;
 
             // Draw background
             if (style_.background_color.a() > 0) {
                 if (style_.border_radius > 0) {
-                    renderer.fill_rounded_rect(
+                    canvas.fill_rounded_rect(
                         bounds_,
                         style_.border_radius,
                         style_.border_radius,
                         style_.background_color
                     );
                 } else {
-                    renderer.fill_rect(bounds_, style_.background_color);
+                    canvas.fill_rect(bounds_, style_.background_color);
                 }
             }
 
             // Draw border
             if (style_.border_width > 0 && style_.border_color.a() > 0) {
                 if (style_.border_radius > 0) {
-                    renderer.draw_rounded_rect(
+                    canvas.draw_rounded_rect(
                         bounds_,
                         style_.border_radius,
                         style_.border_radius,
@@ -146,13 +209,95 @@ namespace zuu::widget {
                         style_.border_width
                     );
                 } else {
-                    renderer.draw_rect(bounds_, style_.border_color, style_.border_width);
+                    canvas.draw_rect(bounds_, style_.border_color, style_.border_width);
                 }
             }
 
             set_flag(WidgetFlag::Dirty, false);
         }
 
+        // Entry point dari Container. Widget yang tidak Dirty langsung replay
+        // cache tanpa menghitung apa pun. Kalau Dirty, hash state dibandingkan
+        // dulu: perubahan yang kembali ke state semula (hover masuk-keluar,
+        // set_style dengan nilai sama) tetap pakai cache. Selain itu render()
+        // direkam ulang ke cache lalu di-replay ke canvas.
+        void paint(Canvas& canvas) {
+            if (is_cached_as_layer()) {
+                paint_layer(canvas);
+                return;
+            }
+            if (!is_render_cacheable()) {
+                render(canvas);
+                return;
+            }
+
+            auto& stats = canvas.get_frame_stats();
+            if (render_cache_valid_) {
+                bool hit = !is_dirty();
+                if (!hit && render_state_hash() == render_cache_key_) {
+                    set_flag(WidgetFlag::Dirty, false);
+                    hit = true;
+                }
+                if (hit) {
+                    ++stats.widgets_cached;
+                    render_cache_.replay(canvas);
+                    return;
+                }
+            }
+
+            render_cache_.reset();
+            render_cache_.set_measure_target(&canvas);
+            render(render_cache_);
+            render_cache_.set_measure_target(nullptr);
+            render_cache_key_ = render_state_hash();
+            render_cache_valid_ = true;
+            render_cache_.replay(canvas);
+        }
+
+        virtual bool is_render_cacheable() const noexcept {
+            return render_cache_enabled_;
+        }
+
+        void set_render_cache_enabled(bool enabled) noexcept {
+            render_cache_enabled_ = enabled;
+            if (!enabled) {
+                invalidate_render_cache();
+            }
+        }
+
+        void invalidate_render_cache() noexcept {
+            render_cache_valid_ = false;
+            render_cache_.reset();
+        }
+
+        // Opt-in untuk subtree yang jarang berubah tapi mahal digambar
+        // (panel statis, teks panjang). Memori layer dibatasi LayerCache.
+        void set_cache_as_layer(bool enabled) {
+            if (is_cached_as_layer() == enabled) return;
+            set_flag(WidgetFlag::CacheAsLayer, enabled);
+            if (!enabled) {
+                LayerCache::global().release(this);
+            }
+        }
+
+        bool is_cached_as_layer() const noexcept { return has_flag(flags_, WidgetFlag::CacheAsLayer); }
+
+        uint64_t render_state_hash() const {
+            constexpr auto transient = static_cast<uint32_t>(WidgetFlag::Dirty | WidgetFlag::LayoutDirty);
+
+            detail::StateHasher hash;
+            hash.add(bounds_)
+                .add(static_cast<uint32_t>(flags_) & ~transient)
+                .add(style_.background_color)
+                .add(style_.border_color)
+                .add(style_.text_color)
+                .add(style_.border_width)
+                .add(style_.border_radius)
+                .add(style_.padding);
+            hash_render_state(hash);
+            return hash.value();
+        }
+
         virtual void update(float dt) {
             // Override for animations/logic
         }
@@ -203,6 +348,30 @@ namespace zuu::widget {
             return false;
         }
 
+        // Area yang bisa disentuh render(): bounds + setengah border (stroke
+        // di tengah outline) + 1px anti-aliasing. Override kalau widget
+        // menggambar di luar bounds-nya.
+        virtual basic_rect<float> get_paint_bounds() const {
+            float pad = (style_.border_width > 0 ? style_.border_width * 0.5f : 0.0f) + 1.0f;
+            return basic_rect<float>(
+                bounds_.x - pad,
+                bounds_.y - pad,
+                bounds_.w + pad * 2.0f,
+                bounds_.h + pad * 2.0f
+            );
+        }
+
+        // Area yang dijamin tertutup piksel opaque setelah render() (dipakai
+        // occlusion culling Container). Default: background style alpha 1
+        // tanpa radius. Override kalau render() tidak menggambar
+        // style_.background_color apa adanya; rect kosong = tidak menutupi.
+        virtual basic_rect<float> get_opaque_bounds() const {
+            if (!is_visible() || !style_.background_color.is_opaque() || style_.border_radius > 0) {
+                return basic_rect<float>();
+            }
+            return bounds_;
+        }
+
         // Hit testing
         virtual bool contains_point(const basic_point<float>& point) const noexcept {
             return point.x >= bounds_.x && point.x <= bounds_.x + bounds_.w &&
@@ -212,6 +381,9 @@ namespace zuu::widget {
         // Property setters
         void set_bounds(const basic_rect<float>& bounds) {
             if (bounds_ == bounds) return;
+            if (is_visible()) {
+                invalidate_rect(get_paint_bounds());  // Area lama
+            }
             bounds_ = bounds;
             set_flag(WidgetFlag::LayoutDirty, true);
             mark_dirty();
@@ -226,6 +398,10 @@ namespace zuu::widget {
         }
 
         void set_visible(bool visible) {
+            if (is_visible() == visible) return;
+            if (!visible) {
+                invalidate_rect(get_paint_bounds());
+            }
             set_flag(WidgetFlag::Visible, visible);
             mark_dirty();
         }
@@ -245,11 +421,20 @@ namespace zuu::widget {
             id_ = id;
         }
 
+        // Pasang di root widget supaya mark_dirty di mana pun di tree
+        // otomatis jadi partial invalidate, mis.
+        //   root->set_damage_callback([&](const auto& r) { window.invalidate(r); });
+        void set_damage_callback(DamageCallback callback) {
+            damage_callback_ = std::move(callback);
+        }
+
+        Widget* get_root() noexcept;
+
         // Property getters
         const basic_rect<float>& get_bounds() const noexcept { return bounds_; }
         const basic_rect<float>& get_content_bounds() const noexcept { return content_bounds_; }
+        // Read-only: render cache / layer hanya di-invalidate lewat set_style
         const WidgetStyle& get_style() const noexcept { return style_; }
-        WidgetStyle& get_style() noexcept { return style_; }
         const std::string& get_id() const noexcept { return id_; }
         Container* get_parent() const noexcept { return parent_; }
 
@@ -317,4 +502,7 @@ namespace zuu::widget {
         friend class Container;
     };
 
-} // namespace zuu::widget
\ No newline at end of file
+} // namespace zuu::widget
+
+// Definisi mark_dirty / invalidate_rect / get_root
+#include "container.hpp"
\ No newline at end of file
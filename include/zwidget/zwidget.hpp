@@ -1,6 +1,15 @@
 #pragma once
 
 #include "unit/window.hpp"
+#include "graphic/software_canvas.hpp"
+#include "graphic/color_convert.hpp"
+#include "graphic/display_list.hpp"
+#include "core/keyboard_state.hpp"
+
+#if ZWIDGET_PLATFORM_HEADLESS
+	#include "platform/headless/event_source.hpp"
+#endif
+
 #include "widgets/checkbox.hpp"
 #include "widgets/combobox.hpp"
 #include "widgets/label.hpp"
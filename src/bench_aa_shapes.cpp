@@ -0,0 +1,182 @@
+#include "zwidget/graphic/software_canvas.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <print>
+#include <vector>
+
+using namespace zuu::widget;
+
+// Benchmark rasterizer AA analitik SoftwareCanvas (rounded rect, ellipse,
+// stroke) terhadap referensi supersampling 16x (grid 4x4):
+//  - kualitas: error coverage (level 8-bit) terhadap ground truth 32x32
+//  - throughput: waktu per shape untuk beberapa ukuran; analitik harus
+//    tumbuh sebanding keliling, supersampling sebanding luas
+
+namespace {
+
+    struct Shape {
+        double x0, y0, x1, y1, rx, ry;
+        double stroke;      // 0 = fill
+    };
+
+    bool inside_box(double px, double py, double x0, double y0, double x1, double y1, double rx, double ry) {
+        if (px < x0 || px >= x1 || py < y0 || py >= y1) return false;
+        rx = std::min(rx, (x1 - x0) * 0.5);
+        ry = std::min(ry, (y1 - y0) * 0.5);
+        if (rx <= 0 || ry <= 0) return true;
+
+        double qx = std::fabs(px - (x0 + x1) * 0.5) - ((x1 - x0) * 0.5 - rx);
+        double qy = std::fabs(py - (y0 + y1) * 0.5) - ((y1 - y0) * 0.5 - ry);
+        if (qx <= 0 || qy <= 0) return true;
+        return (qx / rx) * (qx / rx) + (qy / ry) * (qy / ry) <= 1.0;
+    }
+
+    // Geometri sama dengan SoftwareCanvas: stroke = outer - inner
+    bool inside(const Shape& s, double px, double py) {
+        if (s.stroke <= 0) return inside_box(px, py, s.x0, s.y0, s.x1, s.y1, s.rx, s.ry);
+
+        double h = s.stroke * 0.5;
+        bool rounded = s.rx > 0 && s.ry > 0;
+        return inside_box(px, py, s.x0 - h, s.y0 - h, s.x1 + h, s.y1 + h,
+                rounded ? s.rx + h : 0, rounded ? s.ry + h : 0)
+            && !inside_box(px, py, s.x0 + h, s.y0 + h, s.x1 - h, s.y1 - h,
+                std::max(0.0, s.rx - h), std::max(0.0, s.ry - h));
+    }
+
+    // Coverage NxN supersampling satu pixel, 0..255
+    uint8_t sampled_coverage(const Shape& s, int x, int y, int n) {
+        int hits = 0;
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < n; ++i) {
+                hits += inside(s, x + (i + 0.5) / n, y + (j + 0.5) / n) ? 1 : 0;
+            }
+        }
+        return static_cast<uint8_t>((hits * 255 + n * n / 2) / (n * n));
+    }
+
+    void draw_analytic(SoftwareCanvas& canvas, const Shape& s, ColorU8 color) {
+        basic_rect<float> rect(
+            static_cast<float>(s.x0), static_cast<float>(s.y0),
+            static_cast<float>(s.x1 - s.x0), static_cast<float>(s.y1 - s.y0));
+        if (s.stroke > 0) {
+            canvas.draw_rounded_rect(rect, static_cast<float>(s.rx), static_cast<float>(s.ry), color,
+                static_cast<float>(s.stroke));
+        } else {
+            canvas.fill_rounded_rect(rect, static_cast<float>(s.rx), static_cast<float>(s.ry), color);
+        }
+    }
+
+    // Rasterizer referensi 16x: coverage per pixel di bounding box, lalu
+    // blend dengan kernel masked yang sama dengan SoftwareCanvas
+    void draw_supersampled(std::vector<uint32_t>& surface, int width, const Shape& s, uint32_t src,
+                           std::vector<uint8_t>& row) {
+        const auto& kernels = span_kernels<PixelFormat::Bgra8>();
+        double pad = s.stroke * 0.5;
+        int x0 = static_cast<int>(std::floor(s.x0 - pad));
+        int y0 = static_cast<int>(std::floor(s.y0 - pad));
+        int x1 = static_cast<int>(std::ceil(s.x1 + pad));
+        int y1 = static_cast<int>(std::ceil(s.y1 + pad));
+
+        for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                row[x - x0] = sampled_coverage(s, x, y, 4);
+            }
+            kernels.blend_mask(surface.data() + static_cast<size_t>(y) * width + x0, row.data(),
+                static_cast<size_t>(x1 - x0), src);
+        }
+    }
+
+    template <typename Fn>
+    double time_seconds(Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void quality() {
+        const Shape shapes[] = {
+            {10.3, 20.6, 150.2, 90.9, 12, 8, 0},
+            {40.5, 40.5, 160.5, 160.5, 60, 60, 0},      // circle
+            {20.25, 60.75, 180.5, 140.1, 80, 40, 0},    // ellipse
+            {5, 5, 195, 195, 30, 30, 3},                // rounded stroke
+            {30.4, 30.4, 170.4, 120.4, 70, 45, 1},      // ellipse stroke (hairline)
+            {60.25, 100.7, 61.1, 180.2, 0.3, 4, 0},     // sub-pixel lebar
+        };
+        constexpr int size = 200;
+
+        double analytic_sum = 0, sampled_sum = 0, analytic_max = 0, sampled_max = 0;
+        long pixels = 0;
+        for (const auto& s : shapes) {
+            SoftwareCanvas canvas(basic_size<int>(size, size));
+            draw_analytic(canvas, s, Color::White());
+
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    double truth = sampled_coverage(s, x, y, 32);
+                    double analytic = canvas.pixel_at(x, y) >> 24;
+                    double sampled = sampled_coverage(s, x, y, 4);
+                    if (truth == 0 && analytic == 0 && sampled == 0) continue;
+
+                    analytic_sum += std::fabs(analytic - truth);
+                    sampled_sum += std::fabs(sampled - truth);
+                    analytic_max = std::max(analytic_max, std::fabs(analytic - truth));
+                    sampled_max = std::max(sampled_max, std::fabs(sampled - truth));
+                    ++pixels;
+                }
+            }
+        }
+
+        std::println("Quality vs 32x32 ground truth ({} covered pixels, error in 8-bit levels)", pixels);
+        std::println("  analytic       mean {:.3f}  max {:.1f}", analytic_sum / pixels, analytic_max);
+        std::println("  supersample16  mean {:.3f}  max {:.1f}", sampled_sum / pixels, sampled_max);
+    }
+
+    void throughput() {
+        constexpr int surface_size = 1100;
+        const int sizes[] = {16, 64, 256, 1024};
+        ColorU8 color = Color(0.3f, 0.6f, 1.0f, 0.8f);
+        uint32_t src = detail::pack_premultiplied(color);
+
+        SoftwareCanvas canvas(basic_size<int>(surface_size, surface_size));
+        std::vector<uint32_t> surface(static_cast<size_t>(surface_size) * surface_size, 0xFF000000u);
+        std::vector<uint8_t> row(surface_size);
+
+        std::println("Throughput (us per shape; ns per perimeter pixel)");
+        for (const char* kind : {"circle", "rounded rect", "rounded stroke 2px"}) {
+            std::println("  {}", kind);
+            for (int size : sizes) {
+                double d = size;
+                Shape s{10.3, 10.6, 10.3 + d, 10.6 + d * 0.75, d * 0.5, d * 0.375, 0};
+                if (kind[0] == 'r') {
+                    s.rx = s.ry = std::min(8.0, d * 0.25);
+                }
+                if (kind[8] == 's') s.stroke = 2.0;
+
+                double perimeter = std::numbers::pi * (d + d * 0.75) * 0.5 * 2.0;
+                int iterations = std::max(4, 200000 / size);
+
+                double analytic = time_seconds([&] {
+                    for (int i = 0; i < iterations; ++i) draw_analytic(canvas, s, color);
+                }) / iterations;
+
+                int sampled_iterations = std::max(1, iterations / 20);
+                double sampled = time_seconds([&] {
+                    for (int i = 0; i < sampled_iterations; ++i) draw_supersampled(surface, surface_size, s, src, row);
+                }) / sampled_iterations;
+
+                std::println("    {:>4}px  analytic {:9.2f} us ({:6.1f} ns/perimeter px)   supersample16 {:10.2f} us   {:6.1f}x",
+                    size, analytic * 1e6, analytic * 1e9 / perimeter, sampled * 1e6, sampled / analytic);
+            }
+        }
+    }
+
+} // namespace
+
+int main() {
+    quality();
+    throughput();
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include "zwidget/graphic/dirty_region_tracker.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace zuu::widget;
+
+// Microbenchmark DirtyRegionTracker: throughput mark_dirty (+ resolve per
+// frame) dan overdraw (piksel yang dicat vs damage eksak) dibanding tracker
+// lama (merge ke overlap pertama, full redraw di atas 10 rect).
+
+namespace {
+
+    // Salinan tracker sebelum Region, untuk pembanding
+    class LegacyDirtyRegionTracker {
+    private:
+        std::vector<basic_rect<int>> dirty_regions_;
+        bool is_full_dirty_{false};
+
+        static bool regions_overlap(const basic_rect<int>& a, const basic_rect<int>& b) {
+            return !(a.x + a.w < b.x || b.x + b.w < a.x ||
+                     a.y + a.h < b.y || b.y + b.h < a.y);
+        }
+
+        static basic_rect<int> merge_regions(const basic_rect<int>& a, const basic_rect<int>& b) {
+            int x1 = (a.x < b.x) ? a.x : b.x;
+            int y1 = (a.y < b.y) ? a.y : b.y;
+            int x2 = ((a.x + a.w) > (b.x + b.w)) ? (a.x + a.w) : (b.x + b.w);
+            int y2 = ((a.y + a.h) > (b.y + b.h)) ? (a.y + a.h) : (b.y + b.h);
+            return basic_rect<int>(x1, y1, x2 - x1, y2 - y1);
+        }
+
+    public:
+        void mark_dirty(const basic_rect<int>& region) {
+            if (is_full_dirty_) return;
+            if (region.w <= 0 || region.h <= 0) return;
+
+            bool merged = false;
+            for (auto& existing : dirty_regions_) {
+                if (regions_overlap(existing, region)) {
+                    existing = merge_regions(existing, region);
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                dirty_regions_.push_back(region);
+            }
+            if (dirty_regions_.size() > 10) {
+                is_full_dirty_ = true;
+                dirty_regions_.clear();
+            }
+        }
+
+        void clear() {
+            dirty_regions_.clear();
+            is_full_dirty_ = false;
+        }
+
+        bool is_full_dirty() const noexcept { return is_full_dirty_; }
+        const std::vector<basic_rect<int>>& get_regions() const noexcept { return dirty_regions_; }
+    };
+
+    struct Scenario {
+        std::string name;
+        int indicators;
+        int size;
+        int step;
+    };
+
+    struct Result {
+        double mrects_per_sec{0};
+        double us_per_frame{0};
+        double avg_rects{0};
+        double overdraw_pct{0};
+        double full_pct{0};
+    };
+
+    constexpr int kWidth = 1920;
+    constexpr int kHeight = 1080;
+    constexpr int kFrames = 2000;
+
+    // Satu frame = setiap indikator bergerak, bounds lama + baru di-invalidate
+    std::vector<std::vector<basic_rect<int>>> make_frames(const Scenario& sc) {
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<int> px(0, kWidth - sc.size - 1);
+        std::uniform_int_distribution<int> py(0, kHeight - sc.size - 1);
+        std::uniform_int_distribution<int> dir(-sc.step, sc.step);
+
+        std::vector<basic_rect<int>> items;
+        for (int i = 0; i < sc.indicators; ++i) {
+            items.emplace_back(px(rng), py(rng), sc.size, sc.size);
+        }
+
+        std::vector<std::vector<basic_rect<int>>> frames(kFrames);
+        for (auto& frame : frames) {
+            for (auto& item : items) {
+                frame.push_back(item);
+                item.x = std::clamp(item.x + dir(rng), 0, kWidth - sc.size);
+                item.y = std::clamp(item.y + dir(rng), 0, kHeight - sc.size);
+                frame.push_back(item);
+            }
+        }
+        return frames;
+    }
+
+    int64_t exact_area(const std::vector<basic_rect<int>>& frame) {
+        return Region::from_rects(frame).area();
+    }
+
+    template <typename Fn>
+    double time_seconds(Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    Result run_new(const std::vector<std::vector<basic_rect<int>>>& frames) {
+        DirtyRegionTracker tracker;
+        tracker.set_bounds(basic_rect<int>(0, 0, kWidth, kHeight));
+
+        Result r;
+        size_t total_rects = 0;
+        double rect_count = 0;
+        int64_t painted = 0, exact = 0;
+        int full = 0;
+
+        double seconds = time_seconds([&] {
+            for (const auto& frame : frames) {
+                for (const auto& rect : frame) {
+                    tracker.mark_dirty(rect);
+                }
+                rect_count += static_cast<double>(tracker.get_regions().size());
+                full += tracker.is_full_dirty() ? 1 : 0;
+                painted += tracker.get_paint_area();
+                total_rects += frame.size();
+                tracker.clear();
+            }
+        });
+
+        for (const auto& frame : frames) exact += exact_area(frame);
+
+        r.mrects_per_sec = static_cast<double>(total_rects) / seconds / 1e6;
+        r.us_per_frame = seconds * 1e6 / frames.size();
+        r.avg_rects = rect_count / frames.size();
+        r.overdraw_pct = 100.0 * static_cast<double>(painted - exact) / static_cast<double>(exact);
+        r.full_pct = 100.0 * full / frames.size();
+        return r;
+    }
+
+    Result run_legacy(const std::vector<std::vector<basic_rect<int>>>& frames) {
+        LegacyDirtyRegionTracker tracker;
+
+        Result r;
+        size_t total_rects = 0;
+        double rect_count = 0;
+        int64_t painted = 0, exact = 0;
+        int full = 0;
+
+        double seconds = time_seconds([&] {
+            for (const auto& frame : frames) {
+                for (const auto& rect : frame) {
+                    tracker.mark_dirty(rect);
+                }
+                if (tracker.is_full_dirty()) {
+                    ++full;
+                    painted += static_cast<int64_t>(kWidth) * kHeight;
+                } else {
+                    rect_count += static_cast<double>(tracker.get_regions().size());
+                    for (const auto& rect : tracker.get_regions()) {
+                        painted += static_cast<int64_t>(rect.w) * rect.h;
+                    }
+                }
+                total_rects += frame.size();
+                tracker.clear();
+            }
+        });
+
+        for (const auto& frame : frames) exact += exact_area(frame);
+
+        r.mrects_per_sec = static_cast<double>(total_rects) / seconds / 1e6;
+        r.us_per_frame = seconds * 1e6 / frames.size();
+        r.avg_rects = rect_count / frames.size();
+        r.overdraw_pct = 100.0 * static_cast<double>(painted - exact) / static_cast<double>(exact);
+        r.full_pct = 100.0 * full / frames.size();
+        return r;
+    }
+
+    void print_result(const char* name, const Result& r) {
+        std::println("  {}: {:.2f} Mrect/s ({:.1f} us/frame), {:.1f} rects/frame, overdraw {:.1f}%, full repaint {:.1f}%",
+            name, r.mrects_per_sec, r.us_per_frame, r.avg_rects, r.overdraw_pct, r.full_pct);
+    }
+
+} // namespace
+
+int main() {
+    const Scenario scenarios[] = {
+        {"1 hovered widget (40px)", 1, 40, 0},
+        {"8 spinners (24px)", 8, 24, 2},
+        {"64 animated indicators (16px)", 64, 16, 2},
+        {"256 animated indicators (12px)", 256, 12, 3},
+    };
+
+    std::println("DirtyRegionTracker benchmark, surface {}x{}, {} frames", kWidth, kHeight, kFrames);
+
+    for (const auto& sc : scenarios) {
+        auto frames = make_frames(sc);
+        std::println("{}", sc.name);
+        print_result("legacy", run_legacy(frames));
+        print_result("region", run_new(frames));
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include "zwidget/graphic/font.hpp"
+#include "zwidget/graphic/software_canvas.hpp"
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <string>
+#include <vector>
+
+using namespace zuu::widget;
+
+// Benchmark rasterizer TrueType: glyph ASCII cetak (0x21..0x7E) x 4 offset
+// subpixel pada ukuran UI umum 12-20px, dirasterisasi ulang tanpa cache.
+// Sebagai pembanding, teks yang sama digambar lewat SoftwareCanvas dengan
+// GlyphAtlas hangat (lookup + blit saja). Font: argumen pertama, atau
+// font sistem umum kalau ada.
+
+namespace {
+
+    constexpr int kRounds = 20;
+    constexpr float kSizes[] = {12.0f, 14.0f, 16.0f, 18.0f, 20.0f};
+
+    template <typename Fn>
+    double time_seconds(Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::shared_ptr<Font> open_font(int argc, char** argv, std::string& path) {
+        std::vector<std::string> candidates;
+        if (argc > 1) candidates.push_back(argv[1]);
+        candidates.insert(candidates.end(), {
+            "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+            "/usr/share/fonts/TTF/DejaVuSans.ttf",
+            "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+            "/System/Library/Fonts/Supplemental/Arial.ttf",
+            "C:/Windows/Fonts/segoeui.ttf",
+        });
+        for (const auto& candidate : candidates) {
+            if (auto font = Font::from_file(candidate)) {
+                path = candidate;
+                return font;
+            }
+        }
+        return nullptr;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string path;
+    std::shared_ptr<Font> font;
+    double load = time_seconds([&] { font = open_font(argc, argv, path); });
+    if (!font) {
+        std::println("No TrueType font found; pass a .ttf path as the first argument");
+        return 1;
+    }
+
+    std::vector<uint32_t> glyphs;
+    for (char32_t c = 0x21; c < 0x7F; ++c) glyphs.push_back(font->glyph_index(c));
+
+    std::println("Font {} ({} glyphs, {} units/em), mmap load {:.3f} ms",
+        path, font->glyph_count(), font->units_per_em(), load * 1e3);
+    std::println("Rasterize {} glyphs x {} subpixel offsets, {} rounds",
+        glyphs.size(), GlyphAtlas::subpixel_steps, kRounds);
+
+    for (float size : kSizes) {
+        size_t pixels = 0;
+        double seconds = time_seconds([&] {
+            for (int round = 0; round < kRounds; ++round) {
+                for (uint32_t glyph : glyphs) {
+                    for (int sub = 0; sub < GlyphAtlas::subpixel_steps; ++sub) {
+                        GlyphBitmap bitmap = font->rasterize(glyph, size, static_cast<float>(sub) / GlyphAtlas::subpixel_steps);
+                        pixels += bitmap.coverage.size();
+                    }
+                }
+            }
+        });
+        double count = static_cast<double>(glyphs.size()) * GlyphAtlas::subpixel_steps * kRounds;
+        std::println("  {:4.0f}px  {:10.0f} glyphs/s  {:6.2f} us/glyph  avg {:5.1f} px",
+            size, count / seconds, seconds / count * 1e6, static_cast<double>(pixels) / count);
+    }
+
+    // Jalur draw_text dengan atlas hangat: satu paragraf ASCII per ukuran
+    FontCollection::global().add(font);
+    std::wstring line;
+    for (wchar_t c = 0x21; c < 0x7F; ++c) line.push_back(c);
+
+    SoftwareCanvas canvas(basic_size<int>(1600, 200));
+    std::println("Cached draw_text (GlyphAtlas lookup + masked blit)");
+    for (float size : kSizes) {
+        TextFormat format;
+        format.size = size;
+        canvas.draw_text(line, basic_rect<float>(0, 0, 1600, 200), Color::White(), &format);
+
+        GlyphAtlas::global().reset_stats();
+        double seconds = time_seconds([&] {
+            for (int round = 0; round < kRounds * 50; ++round) {
+                canvas.draw_text(line, basic_rect<float>(0.25f * round, 0, 1600, 200), Color::White(), &format);
+            }
+        });
+        double count = static_cast<double>(line.size()) * kRounds * 50;
+        std::println("  {:4.0f}px  {:10.0f} glyphs/s  hit rate {:.1f}%",
+            size, count / seconds,
+            100.0 * GlyphAtlas::global().hits() / std::max<uint64_t>(1, GlyphAtlas::global().hits() + GlyphAtlas::global().misses()));
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include "zwidget/graphic/batching_canvas.hpp"
+#include "zwidget/graphic/software_canvas.hpp"
+#include "zwidget/widgets/button.hpp"
+#include "zwidget/widgets/checkbox.hpp"
+#include "zwidget/widgets/label.hpp"
+#include "zwidget/widgets/panel.hpp"
+#include "zwidget/widgets/slider.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace zuu::widget;
+
+// Benchmark rasterisasi tiled: full repaint 4K (seperti setelah resize /
+// mark_full_dirty) dari scene sintetis 5000 widget. Membandingkan flush
+// serial BatchingCanvas dengan mode tiled untuk 1..N worker, dan memastikan
+// hasil pixel identik.
+
+namespace {
+
+    constexpr int kWidth = 3840;
+    constexpr int kHeight = 2160;
+    constexpr int kWidgets = 5000;
+    constexpr int kFrames = 8;
+
+    using Surface = BatchingCanvas<SoftwareCanvas>;
+
+    std::unique_ptr<Panel> build_scene() {
+        auto root = std::make_unique<Panel>();
+        root->set_bounds(basic_rect<float>(0, 0, kWidth, kHeight));
+
+        constexpr int columns = 50;
+        constexpr int rows = kWidgets / columns;
+        float cell_w = static_cast<float>(kWidth) / columns;
+        float cell_h = static_cast<float>(kHeight) / rows;
+
+        for (int i = 0; i < kWidgets; ++i) {
+            basic_rect<float> cell(
+                (i % columns) * cell_w + 4, (i / columns) * cell_h + 2, cell_w - 8, cell_h - 4);
+            std::wstring text = L"Item " + std::to_wstring(i);
+
+            switch (i % 4) {
+                case 0: root->add_child<Button>(text)->set_bounds(cell); break;
+                case 1: root->add_child<Label>(text)->set_bounds(cell); break;
+                case 2: {
+                    auto* check = root->add_child<CheckBox>(text);
+                    check->set_checked(i % 8 == 2);
+                    check->set_bounds(cell);
+                    break;
+                }
+                default: {
+                    auto* slider = root->add_child<Slider>();
+                    slider->set_value(static_cast<float>(i % 100));
+                    slider->set_bounds(cell);
+                    break;
+                }
+            }
+        }
+        root->layout();
+        return root;
+    }
+
+    struct Result {
+        double ms;
+        FrameStats stats;
+    };
+
+    Result render(Surface& surface, Panel& root) {
+        // Frame pertama memanaskan cache widget dan path
+        FrameStats stats;
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f <= kFrames; ++f) {
+            if (f == 1) start = std::chrono::steady_clock::now();
+            surface.get_frame_stats().reset();
+            surface.set_batching(true);
+            surface.clear(Color::from_hex(0x1e1e1e));
+            root.render(surface);
+            surface.set_batching(false);
+            stats = surface.get_frame_stats();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return Result{seconds * 1e3 / kFrames, stats};
+    }
+
+    size_t count_diff(const SoftwareCanvas& a, const SoftwareCanvas& b) {
+        size_t diff = 0;
+        for (int y = 0; y < kHeight; ++y) {
+            for (int x = 0; x < kWidth; ++x) {
+                diff += a.pixel_at(x, y) != b.pixel_at(x, y);
+            }
+        }
+        return diff;
+    }
+
+} // namespace
+
+int main() {
+    auto root = build_scene();
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::println("Full repaint {}x{}, {} widgets, {} frames ({} hardware threads)",
+        kWidth, kHeight, kWidgets, kFrames, cores);
+
+    Surface serial(basic_size<int>(kWidth, kHeight));
+    Result base = render(serial, *root);
+    std::println("  serial flush        {:8.2f} ms/frame  ({} draw calls)", base.ms, base.stats.draw_calls);
+
+    std::vector<unsigned> counts{1};
+    for (unsigned n = 2; n < cores; n *= 2) counts.push_back(n);
+    if (cores > 1) counts.push_back(cores);
+
+    for (int tile : {32, 64, 128}) {
+        std::println("  tile {}x{}", tile, tile);
+        double one = 0;
+        for (unsigned threads : counts) {
+            Surface tiled(basic_size<int>(kWidth, kHeight));
+            tiled.set_tiled(true, tile, threads);
+            Result r = render(tiled, *root);
+            if (threads == 1) one = r.ms;
+
+            std::println("    {:>2} threads  {:8.2f} ms/frame  {:5.2f}x vs 1 thread  {:5.2f}x vs serial  {} tiles  diff {}",
+                threads, r.ms, one / r.ms, base.ms / r.ms, r.stats.tiles, count_diff(serial, tiled));
+        }
+    }
+    return 0;
+}
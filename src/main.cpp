@@ -24,14 +24,18 @@ public:
         // 1. Setup Root Panel (Background Gelap)
         root_ = std::make_unique<Panel>();
         root_->set_bounds(Rectf{ Pointf{0.0f}, size });
-        root_->get_style().background_color = Color::from_hex(0x121212); // Lebih gelap dikit biar elegan
+        WidgetStyle root_style = root_->get_style();
+        root_style.background_color = Color::from_hex(0x121212); // Lebih gelap dikit biar elegan
+        root_->set_style(root_style);
 
         // 2. Setup Content Panel (Kotak Login di tengah)
         Sizef content_size = size / Sizef{ 2.5f, 1.8f }; // Ukuran proporsional
         content_panel_ = root_->add_child<Panel>();
         content_panel_->set_bounds(Rectf{ Pointf{}, content_size });
-        content_panel_->get_style().background_color = Color::from_hex(0x252526);
-        content_panel_->get_style().border_radius = 8.0f; // Kasih radius biar gak kaku
+        WidgetStyle content_panel_style = content_panel_->get_style();
+        content_panel_style.background_color = Color::from_hex(0x252526);
+        content_panel_style.border_radius = 8.0f; // Kasih radius biar gak kaku
+        content_panel_->set_style(content_panel_style);
         
         // Center the panel
         Pointf center_pos = point_cast<float>((size - content_size) / 2.0f);
@@ -29,8 +29,10 @@ public:
     ComprehensiveWidgetDemo(const basic_size<float>& size) {
         root_ = std::make_unique<Panel>();
         root_->set_bounds(basic_rect<float>(0, 0, size.w, size.h));
-        root_->get_style().padding = {20.0f, 20.0f, 20.0f, 20.0f};
-        root_->get_style().background_color = Color::from_hex(0x1e1e1e);
+        WidgetStyle root_style = root_->get_style();
+        root_style.padding = {20.0f, 20.0f, 20.0f, 20.0f};
+        root_style.background_color = Color::from_hex(0x1e1e1e);
+        root_->set_style(root_style);
 
         float y_pos = 0;
         float spacing = 15.0f;
@@ -40,13 +42,17 @@ public:
         // Title
         auto* title = root_->add_child<Label>(L"ZWidget Comprehensive Demo");
         title->set_bounds(basic_rect<float>(0, y_pos, size.w - 40, 40));
-        title->get_style().text_color = Color::from_hex(0x4a90e2);
+        WidgetStyle title_style = title->get_style();
+        title_style.text_color = Color::from_hex(0x4a90e2);
+        title->set_style(title_style);
         y_pos += 50;
 
         // === COLUMN 1: Text Input ===
         auto* section1 = root_->add_child<Label>(L"TEXT INPUT (IMPROVED)");
         section1->set_bounds(basic_rect<float>(col1_x, y_pos, 350, 25));
-        section1->get_style().text_color = Color::from_hex(0xf39c12);
+        WidgetStyle section1_style = section1->get_style();
+        section1_style.text_color = Color::from_hex(0xf39c12);
+        section1->set_style(section1_style);
         y_pos += 30;
 
         // Improved TextBox
@@ -81,13 +87,17 @@ public:
         readonly_box->set_bounds(basic_rect<float>(col1_x, y_pos, 350, 35));
         readonly_box->set_text(L"Read-only text (cannot edit)");
         readonly_box->set_read_only(true);
-        readonly_box->get_style().background_color = Color::from_hex(0x2a2a2a);
+        WidgetStyle readonly_box_style = readonly_box->get_style();
+        readonly_box_style.background_color = Color::from_hex(0x2a2a2a);
+        readonly_box->set_style(readonly_box_style);
         y_pos += 55;
 
         // === COLUMN 1: Sliders ===
         auto* section2 = root_->add_child<Label>(L"SLIDERS");
         section2->set_bounds(basic_rect<float>(col1_x, y_pos, 350, 25));
-        section2->get_style().text_color = Color::from_hex(0xf39c12);
+        WidgetStyle section2_style = section2->get_style();
+        section2_style.text_color = Color::from_hex(0xf39c12);
+        section2->set_style(section2_style);
         y_pos += 30;
 
         // Horizontal slider
@@ -96,7 +106,9 @@ public:
         
         slider_value_label_ = root_->add_child<Label>(L"Value: 50");
         slider_value_label_->set_bounds(basic_rect<float>(col1_x + 200, y_pos, 150, 25));
-        slider_value_label_->get_style().text_color = Color::from_hex(0x4a90e2);
+        WidgetStyle slider_value_label_style = slider_value_label_->get_style();
+        slider_value_label_style.text_color = Color::from_hex(0x4a90e2);
+        slider_value_label_->set_style(slider_value_label_style);
         y_pos += 30;
 
         h_slider_ = root_->add_child<Slider>(SliderOrientation::Horizontal);
@@ -128,7 +140,9 @@ public:
         // === COLUMN 2: ComboBox ===
         auto* section3 = root_->add_child<Label>(L"COMBOBOX / DROPDOWN");
         section3->set_bounds(basic_rect<float>(col2_x, 50, 350, 25));
-        section3->get_style().text_color = Color::from_hex(0xf39c12);
+        WidgetStyle section3_style = section3->get_style();
+        section3_style.text_color = Color::from_hex(0xf39c12);
+        section3->set_style(section3_style);
 
         auto* combo_label = root_->add_child<Label>(L"Select your favorite language:");
         combo_label->set_bounds(basic_rect<float>(col2_x, 80, 350, 25));
@@ -155,7 +169,9 @@ public:
         float col2_y = 170;
         auto* section4 = root_->add_child<Label>(L"CHECKBOXES & RADIO");
         section4->set_bounds(basic_rect<float>(col2_x, col2_y, 350, 25));
-        section4->get_style().text_color = Color::from_hex(0xf39c12);
+        WidgetStyle section4_style = section4->get_style();
+        section4_style.text_color = Color::from_hex(0xf39c12);
+        section4->set_style(section4_style);
         col2_y += 30;
 
         auto* cb1 = root_->add_child<CheckBox>(L"Enable feature A");
@@ -252,8 +268,10 @@ public:
         // === STATUS BAR === FIXED: Better contrast
         auto* status_bar = root_->add_child<Panel>();
         status_bar->set_bounds(basic_rect<float>(0, size.h - 60, size.w - 40, 50));
-        status_bar->get_style().background_color = Color::from_hex(0x2d2d2d);
-        status_bar->get_style().border_color = Color::from_hex(0x3d3d3d);
+        WidgetStyle status_bar_style = status_bar->get_style();
+        status_bar_style.background_color = Color::from_hex(0x2d2d2d);
+        status_bar_style.border_color = Color::from_hex(0x3d3d3d);
+        status_bar->set_style(status_bar_style);
 
         status_label_ = status_bar->add_child<Label>(L"Ready");
         status_label_->set_bounds(basic_rect<float>(10, 10, size.w - 60, 30));
@@ -331,6 +349,11 @@ int main() {
         // Create demo
         ComprehensiveWidgetDemo demo(basic_size<float>(800, 650));
 
+        // Widget yang berubah state meng-invalidate area-nya sendiri
+        demo.get_root()->set_damage_callback([&window](const basic_rect<int>& r) {
+            window.invalidate(r);
+        });
+
         // Set paint callback
         window.set_paint_callback([&demo](Renderer& r) {
             r.clear(Color::from_hex(0x1a1a1a));
@@ -404,7 +427,6 @@ int main() {
 
                     if (me->get_type() == MouseEvent::Type::move) {
                         demo.handle_mouse_move(*me);
-                        window.invalidate();
                     }
                     else if (me->get_type() == MouseEvent::Type::button_press) {
                         if (demo.handle_mouse_down(*me)) {
@@ -416,13 +438,10 @@ int main() {
                                 focused_widget = clicked;
                                 focused_widget->set_focused(true);
                             }
-                            window.invalidate();
                         }
                     }
                     else if (me->get_type() == MouseEvent::Type::button_release) {
-                        if (demo.handle_mouse_up(*me)) {
-                            window.invalidate();
-                        }
+                        demo.handle_mouse_up(*me);
                     }
                 }
 
@@ -447,21 +466,16 @@ int main() {
                                     }
                                     focused_widget = *it;
                                     focused_widget->set_focused(true);
-                                    window.invalidate();
                                 }
                             }
                         }
                         else if (focused_widget) {
-                            if (demo.handle_key_down(*ke)) {
-                                window.invalidate();
-                            }
+                            demo.handle_key_down(*ke);
                         }
                     }
                     else if (ke->get_type() == KeyboardEvent::Type::key_release) {
                         if (focused_widget) {
-                            if (demo.handle_key_up(*ke)) {
-                                window.invalidate();
-                            }
+                            demo.handle_key_up(*ke);
                         }
                     }
                 }
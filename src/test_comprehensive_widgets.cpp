@@ -32,8 +32,10 @@ public:
     FormDemo(const basic_size<float>& size) {
         root_ = std::make_unique<Panel>();
         root_->set_bounds(basic_rect<float>(0, 0, size.w, size.h));
-        root_->get_style().padding = {20.0f, 20.0f, 20.0f, 20.0f};
-        root_->get_style().background_color = Color::from_hex(0x1e1e1e);
+        WidgetStyle root_style = root_->get_style();
+        root_style.padding = {20.0f, 20.0f, 20.0f, 20.0f};
+        root_style.background_color = Color::from_hex(0x1e1e1e);
+        root_->set_style(root_style);
 
         float y_pos = 0;
         float spacing = 15.0f;
@@ -41,7 +43,9 @@ public:
         // Title
         auto* title = root_->add_child<Label>(L"Registration Form");
         title->set_bounds(basic_rect<float>(0, y_pos, size.w - 40, 40));
-        title->get_style().text_color = Color::from_hex(0x4a90e2);
+        WidgetStyle title_style = title->get_style();
+        title_style.text_color = Color::from_hex(0x4a90e2);
+        title->set_style(title_style);
         y_pos += 50;
 
         // Name input
@@ -254,6 +258,11 @@ int main() {
         // Create form demo
         FormDemo demo(basic_size<float>(500, 700));
 
+        // Widget yang berubah state meng-invalidate area-nya sendiri
+        demo.get_root()->set_damage_callback([&window](const basic_rect<int>& r) {
+            window.invalidate(r);
+        });
+
         // Set paint callback
         window.set_paint_callback([&demo](Renderer& r) {
             r.clear(Color::from_hex(0x1a1a1a));
@@ -328,7 +337,6 @@ int main() {
 
                     if (me->get_type() == MouseEvent::Type::move) {
                         demo.handle_mouse_move(*me);
-                        window.invalidate();
                     }
                     else if (me->get_type() == MouseEvent::Type::button_press) {
                         if (demo.handle_mouse_down(*me)) {
@@ -340,13 +348,10 @@ int main() {
                                 focused_widget = clicked;
                                 focused_widget->set_focused(true);
                             }
-                            window.invalidate();
                         }
                     }
                     else if (me->get_type() == MouseEvent::Type::button_release) {
-                        if (demo.handle_mouse_up(*me)) {
-                            window.invalidate();
-                        }
+                        demo.handle_mouse_up(*me);
                     }
                 }
 
@@ -371,21 +376,16 @@ int main() {
                                     }
                                     focused_widget = *it;
                                     focused_widget->set_focused(true);
-                                    window.invalidate();
                                 }
                             }
                         }
                         else if (focused_widget) {
-                            if (demo.handle_key_down(*ke)) {
-                                window.invalidate();
-                            }
+                            demo.handle_key_down(*ke);
                         }
                     }
                     else if (ke->get_type() == KeyboardEvent::Type::key_release) {
                         if (focused_widget) {
-                            if (demo.handle_key_up(*ke)) {
-                                window.invalidate();
-                            }
+                            demo.handle_key_up(*ke);
                         }
                     }
                 }
@@ -0,0 +1,179 @@
+#include "zwidget/zwidget.hpp"
+#include "zwidget/widgets/button.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <print>
+#include <unordered_map>
+#include <vector>
+
+using namespace zuu::widget;
+
+// Load test backend headless: banyak virtual window, masing-masing dengan
+// widget tree sendiri, diberi input sintetis lalu dirender ke SoftwareCanvas.
+
+struct VirtualApp {
+    std::unique_ptr<Window> window;
+    std::unique_ptr<Panel> root;
+    Label* status{nullptr};
+    int clicks{0};
+
+    VirtualApp(int index, const Size& size) {
+        window = std::make_unique<Window>(
+            "Headless " + std::to_string(index), size, WindowStyle::Borderless
+        );
+
+        root = std::make_unique<Panel>();
+        root->set_bounds(basic_rect<float>(0, 0, static_cast<float>(size.w), static_cast<float>(size.h)));
+        WidgetStyle root_style = root->get_style();
+        root_style.background_color = Color::from_hex(0x1e1e1e);
+        root->set_style(root_style);
+
+        auto* title = root->add_child<Label>(L"ZWidget headless");
+        title->set_bounds(basic_rect<float>(10, 10, 300, 30));
+
+        auto* button = root->add_child<Button>(L"Click me");
+        button->set_bounds(basic_rect<float>(10, 50, 120, 36));
+        button->on_click([this](Button*) {
+            ++clicks;
+            status->set_text(L"Clicks: " + std::to_wstring(clicks));
+        });
+
+        auto* check = root->add_child<CheckBox>(L"Enabled");
+        check->set_bounds(basic_rect<float>(150, 50, 150, 30));
+
+        auto* slider = root->add_child<Slider>();
+        slider->set_bounds(basic_rect<float>(10, 100, 280, 30));
+
+        auto* text = root->add_child<TextBox>();
+        text->set_bounds(basic_rect<float>(10, 140, 280, 32));
+        root->set_focused_child(text);
+
+        status = root->add_child<Label>(L"Clicks: 0");
+        status->set_bounds(basic_rect<float>(10, 185, 280, 30));
+        root->layout();
+
+        // Perubahan state widget otomatis jadi partial invalidate
+        root->set_damage_callback([this](const basic_rect<int>& r) {
+            window->invalidate(r);
+        });
+
+        window->set_paint_callback([this](Renderer& r) {
+            r.clear(Color::from_hex(0x1a1a1a));
+            if (root->needs_layout()) {
+                root->layout();
+            }
+            root->render(r);
+        });
+    }
+
+    void handle(const Event& event) {
+        if (auto* me = event.get_if<MouseEvent>()) {
+            switch (me->get_type()) {
+                case MouseEvent::Type::move: root->handle_mouse_move(*me); break;
+                case MouseEvent::Type::button_press: root->handle_mouse_down(*me); break;
+                case MouseEvent::Type::button_release: root->handle_mouse_up(*me); break;
+                default: break;
+            }
+        }
+        else if (auto* ke = event.get_if<KeyboardEvent>()) {
+            if (ke->get_type() == KeyboardEvent::Type::key_press) {
+                root->handle_key_down(*ke);
+            } else {
+                root->handle_key_up(*ke);
+            }
+        }
+    }
+};
+
+// Occlusion di bawah transform: konten di-scroll 300px (translate), damage
+// device space hanya baris 0..100. Panel di y=300 harus tetap tergambar
+// walau sibling opaque ada tepat di bawahnya.
+static bool check_translated_occlusion() {
+    Panel root;
+    root.set_bounds(basic_rect<float>(0, 0, 200, 600));
+    auto add_panel = [&](float y, uint32_t color) {
+        auto* panel = root.add_child<Panel>();
+        panel->set_bounds(basic_rect<float>(0, y, 200, 100));
+        WidgetStyle style = panel->get_style();
+        style.background_color = Color::from_hex(color);
+        panel->set_style(style);
+    };
+    add_panel(300, 0xff0000);
+    add_panel(400, 0x00ff00);
+    root.layout();
+
+    SoftwareCanvas canvas(basic_size<int>(200, 200));
+    Region damage(basic_rect<int>(0, 0, 200, 100));
+    canvas.set_damage(&damage);
+    canvas.translate(0, -300);
+    root.render(canvas);
+    canvas.set_damage(nullptr);
+
+    bool ok = canvas.get_frame_stats().widgets_occluded == 0
+        && canvas.pixel_at(10, 50) == canvas.pixel_at(10, 98)
+        && (canvas.pixel_at(10, 50) & 0xffffffu) == 0xff0000u;
+    std::println("Occlusion under translated parent: {}", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    if (!check_translated_occlusion()) return 1;
+
+    const int window_count = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int frames = argc > 2 ? std::atoi(argv[2]) : 30;
+    const Size size(320, 240);
+
+    Application::initialize("HeadlessLoadTest");
+
+    std::vector<std::unique_ptr<VirtualApp>> apps;
+    std::unordered_map<Window*, VirtualApp*> by_window;
+    apps.reserve(window_count);
+    for (int i = 0; i < window_count; ++i) {
+        apps.push_back(std::make_unique<VirtualApp>(i, size));
+        by_window[apps.back()->window.get()] = apps.back().get();
+    }
+
+    std::println("Created {} virtual windows ({}x{})", Application::window_count(), size.w, size.h);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t events = 0;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        for (auto& app : apps) {
+            Window& w = *app->window;
+            HeadlessEventSource::mouse_move(w, basic_point<int>(20 + frame, 60));
+            HeadlessEventSource::click(w, basic_point<int>(40, 60));
+            HeadlessEventSource::key_press(w, KeyboardEvent::KeyCode::A);
+        }
+
+        // Drain queue; PollEvent juga me-repaint window yang ter-invalidate
+        Event event;
+        while (EventDispatcher::PollEvent(event)) {
+            auto it = by_window.find(event.get_window());
+            if (it != by_window.end()) {
+                it->second->handle(event);
+            }
+            ++events;
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double window_frames = static_cast<double>(window_count) * frames;
+
+    std::println("{} frames x {} windows in {:.3f}s", frames, window_count, elapsed);
+    std::println("  {:.0f} window-frames/s, {:.0f} events/s", window_frames / elapsed, events / elapsed);
+
+    if (!apps.empty()) {
+        std::println("  window 0 clicks: {}", apps.front()->clicks);
+        const auto& stats = apps.front()->window->get_renderer().get_frame_stats();
+        std::println("  window 0 last frame: {} widgets visited, {} drawn ({} from cache)",
+            stats.widgets_visited, stats.widgets_drawn, stats.widgets_cached);
+        std::println("  window 0 last frame: {} draw calls -> {} submitted ({} batches)",
+            stats.draw_calls, stats.submitted_draw_calls, stats.batches);
+        apps.front()->window->get_renderer().write_bmp("headless_window0.bmp");
+    }
+
+    Application::shutdown();
+    return 0;
+}
@@ -33,7 +33,9 @@ int main() {
         // Create root container
         auto root = std::make_unique<Panel>();
         root->set_bounds(basic_rect<float>(0, 0, 900, 700));
-        root->get_style().padding = {20.0f, 20.0f, 20.0f, 20.0f};
+        WidgetStyle root_style = root->get_style();
+        root_style.padding = {20.0f, 20.0f, 20.0f, 20.0f};
+        root->set_style(root_style);
 
         // Create title label
         auto* title = root->add_child<Label>(L"Widget System Demo");
@@ -92,12 +94,14 @@ int main() {
             label->set_bounds(basic_rect<float>(10, 10, 100, 30));
             
             float hue = (i * 60.0f) / 360.0f;
-            panel->get_style().background_color = Color(
+            WidgetStyle panel_style = panel->get_style();
+            panel_style.background_color = Color(
                 0.5f + 0.5f * std::cos(hue * 6.28f),
                 0.5f + 0.5f * std::cos((hue + 0.33f) * 6.28f),
                 0.5f + 0.5f * std::cos((hue + 0.67f) * 6.28f),
                 1.0f
             );
+            panel->set_style(panel_style);
         }
 
         // Info label
@@ -110,6 +114,11 @@ int main() {
         // Perform initial layout
         root->layout();
 
+        // Widget yang berubah state meng-invalidate area-nya sendiri
+        root->set_damage_callback([&window](const basic_rect<int>& r) {
+            window.invalidate(r);
+        });
+
         // Set paint callback
         window.set_paint_callback([&root](Renderer& r) {
             r.clear(Color::from_hex(0x1a1a1a));
@@ -178,7 +187,6 @@ int main() {
 
                     if (me->get_type() == MouseEvent::Type::move) {
                         root->handle_mouse_move(*me);
-                        window.invalidate();
                     }
                     else if (me->get_type() == MouseEvent::Type::button_press) {
                         if (root->handle_mouse_down(*me)) {
@@ -191,13 +199,10 @@ int main() {
                                 focused_widget = clicked;
                                 focused_widget->set_focused(true);
                             }
-                            window.invalidate();
                         }
                     }
                     else if (me->get_type() == MouseEvent::Type::button_release) {
-                        if (root->handle_mouse_up(*me)) {
-                            window.invalidate();
-                        }
+                        root->handle_mouse_up(*me);
                     }
                 }
 
@@ -223,21 +228,16 @@ int main() {
                                     }
                                     focused_widget = *it;
                                     focused_widget->set_focused(true);
-                                    window.invalidate();
                                 }
                             }
                         }
                         else if (focused_widget) {
-                            if (focused_widget->handle_key_down(*ke)) {
-                                window.invalidate();
-                            }
+                            focused_widget->handle_key_down(*ke);
                         }
                     }
                     else if (ke->get_type() == KeyboardEvent::Type::key_release) {
                         if (focused_widget) {
-                            if (focused_widget->handle_key_up(*ke)) {
-                                window.invalidate();
-                            }
+                            focused_widget->handle_key_up(*ke);
                         }
                     }
                 }